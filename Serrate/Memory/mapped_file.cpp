@@ -0,0 +1,159 @@
+#include "mapped_file.hpp"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+Bool MappedFile::initialize(const Char *path) noexcept
+{
+    assert(path && "Invalid pointer!");
+    assert(!data && "File is already mapped!");
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    Void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    data          = byte_cast(view);
+    size          = USize(fileSize.QuadPart);
+    fileHandle    = file;
+    mappingHandle = mapping;
+#else
+    const Int32 file = open(path, O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0 || fileStatus.st_size == 0)
+    {
+        close(file);
+        return false;
+    }
+
+    Void *view = mmap(nullptr, USize(fileStatus.st_size), PROT_READ, MAP_SHARED, file, 0);
+    // Mapping keeps its own reference to file
+    close(file);
+    if (view == MAP_FAILED)
+    {
+        return false;
+    }
+
+    data = byte_cast(view);
+    size = USize(fileStatus.st_size);
+#endif
+    return true;
+}
+
+Bool MappedFile::write(const Char *path, const Byte *bytes, const USize count) noexcept
+{
+    assert(path && (bytes || count == 0) && "Invalid pointer!");
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_WRITE, 0, nullptr,
+                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    USize written = 0;
+    while (written < count)
+    {
+        const DWORD chunk = DWORD(std::min(count - written, USize(1) << 30));
+        DWORD chunkWritten = 0;
+        if (!WriteFile(file, bytes + written, chunk, &chunkWritten, nullptr) || chunkWritten == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+        written += chunkWritten;
+    }
+
+    return CloseHandle(file) != 0;
+#else
+    const Int32 file = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (file < 0)
+    {
+        return false;
+    }
+
+    USize written = 0;
+    while (written < count)
+    {
+        const SSize chunkWritten = ::write(file, bytes + written, count - written);
+        if (chunkWritten <= 0)
+        {
+            close(file);
+            return false;
+        }
+        written += USize(chunkWritten);
+    }
+
+    return close(file) == 0;
+#endif
+}
+
+const Byte *MappedFile::get_data() const noexcept
+{
+    return data;
+}
+
+USize MappedFile::get_size() const noexcept
+{
+    return size;
+}
+
+Bool MappedFile::is_mapped() const noexcept
+{
+    return data != nullptr;
+}
+
+Void MappedFile::finalize() noexcept
+{
+    if (!data)
+    {
+        *this = {};
+        return;
+    }
+
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+#else
+    munmap(const_cast<Byte *>(data), size);
+#endif
+    *this = {};
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+#include "memory_utils.hpp"
+
+// Read only view of whole file mapped into memory, pages are shared between processes mapping the same file.
+// Always finalize after successful initialize.
+class MappedFile
+{
+private:
+    const Byte *data;
+    USize       size;
+    Void       *fileHandle;
+    Void       *mappingHandle;
+
+public:
+    MappedFile() noexcept
+        : data(nullptr)
+        , size(0)
+        , fileHandle(nullptr)
+        , mappingHandle(nullptr)
+    {}
+
+    [[nodiscard]]
+    Bool initialize(const Char *path) noexcept;
+
+    // Writes bytes into file at path, existing file is replaced
+    [[nodiscard]]
+    static Bool write(const Char *path, const Byte *bytes, USize count) noexcept;
+
+    [[nodiscard]]
+    const Byte *get_data() const noexcept;
+
+    [[nodiscard]]
+    USize get_size() const noexcept;
+
+    [[nodiscard]]
+    Bool is_mapped() const noexcept;
+
+    Void finalize() noexcept;
+};
\ No newline at end of file
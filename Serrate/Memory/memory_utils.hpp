@@ -2,18 +2,26 @@
 #include "Serrate/Utilities/types.hpp"
 #include "byte.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <bit>
 #include <new>
 
+#if defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#endif
+
 struct AllocatorInfo
 {
     using Allocate   = Byte *(*)(Void *allocator, USize bytes, USize alignment);
     using Deallocate = Void(*)(Void *allocator, Byte *pointer);
+    using Reallocate = Byte *(*)(Void *allocator, Byte *pointer, USize bytes, USize alignment);
 
     Void *allocator;
     Allocate allocate;
     Deallocate deallocate;
+    Reallocate reallocate = nullptr; // Optional, without it memory is moved to new block
 
     static AllocatorInfo *get_default_allocator()
     {
@@ -21,14 +29,45 @@ struct AllocatorInfo
         {
 	        .allocator  = nullptr,
 	        .allocate   = []([[maybe_unused]] Void *allocator, USize bytes, USize alignment) -> Byte *{ return byte_cast(_aligned_malloc(bytes, alignment)); },
-	        .deallocate = []([[maybe_unused]] Void *allocator, Byte *pointer) { _aligned_free(pointer); }
+	        .deallocate = []([[maybe_unused]] Void *allocator, Byte *pointer) { _aligned_free(pointer); },
+	        .reallocate = []([[maybe_unused]] Void *allocator, Byte *pointer, USize bytes, USize alignment) -> Byte *{ return byte_cast(_aligned_realloc(pointer, bytes, alignment)); }
         };
         return &defaultAllocator;
     }
 };
 
+enum class EGrowthPolicy
+{
+    Linear,    // Adds LINEAR_GROWTH elements, appending n elements costs O(n^2) copies
+    Geometric, // Grows by half, freed blocks can be reused by later growth
+    Double,
+};
+
 namespace Memory
 {
+    constexpr USize CACHE_LINE_SIZE = 64;
+    constexpr USize LINEAR_GROWTH   = 32;
+    constexpr USize MIN_GROWTH      = 8;
+
+    // Capacity after growth, never smaller than required
+    constexpr USize grow_capacity(const USize capacity, const USize required, const EGrowthPolicy policy) noexcept
+    {
+        USize grownCapacity = capacity;
+        switch (policy)
+        {
+            case EGrowthPolicy::Linear:
+                grownCapacity = capacity + LINEAR_GROWTH;
+                break;
+            case EGrowthPolicy::Geometric:
+                grownCapacity = capacity + capacity / 2;
+                break;
+            case EGrowthPolicy::Double:
+                grownCapacity = capacity * 2;
+                break;
+        }
+        return std::max(std::max(grownCapacity, required), MIN_GROWTH);
+    }
+
     constexpr USize align_offset(const USize value, const USize alignment) noexcept
     {
         return (value + alignment - 1) & ~(alignment - 1);
@@ -53,6 +92,19 @@ namespace Memory
         return USize(1) << std::bit_width(value - USize(1));
     }
 
+    // Hint only, it never faults so it is safe to call with any address
+    template<typename Type>
+    Void prefetch(const Type *address) noexcept
+    {
+#if defined(_M_X64) || defined(_M_IX86)
+        _mm_prefetch(reinterpret_cast<const Char *>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        (Void)address;
+#endif
+    }
+
     template<Manual Type, Bool CallConstructor = true>
     Type *start_object(Byte *memory) noexcept
     {
@@ -106,6 +158,37 @@ namespace Memory
                                                    count);
     }
 
+    // Grows array of relocatable elements, in place when allocator supports it, otherwise bytes are
+    // copied to new block. Elements from oldCount to newCount are constructed.
+    template <Manual Type>
+    Type *reallocate(AllocatorInfo *allocatorInfo, Type *elements, const USize oldCount, const USize newCount) noexcept
+    {
+        assert(allocatorInfo && "Invalid pointer!");
+        assert(newCount > oldCount && "Reallocation can only grow!");
+
+        Byte *memory = nullptr;
+        if (elements && allocatorInfo->reallocate)
+        {
+            memory = allocatorInfo->reallocate(allocatorInfo->allocator, byte_cast(elements),
+                                               newCount * sizeof(Type), alignof(Type));
+        } else {
+            memory = allocatorInfo->allocate(allocatorInfo->allocator, newCount * sizeof(Type), alignof(Type));
+            if (elements)
+            {
+                std::memcpy(memory, elements, oldCount * sizeof(Type));
+                allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(elements));
+            }
+        }
+        assert(memory && "Failed to reallocate memory!");
+
+        Type *result = reinterpret_cast<Type *>(memory);
+        for (USize i = oldCount; i < newCount; ++i)
+        {
+            new (result + i) Type{};
+        }
+        return std::launder(result);
+    }
+
     template <Manual Type>
     Void deallocate(AllocatorInfo *allocatorInfo, Type *element)
     {
@@ -0,0 +1,135 @@
+#pragma once
+#include "memory_utils.hpp"
+
+#include <algorithm>
+
+// Node storage owned by node based containers. Nodes are carved from chunks requested from parent
+// allocator, every next chunk is twice as big as previous one (up to MAX_CHUNK_COUNT nodes), freed
+// nodes land on intrusive free list and are reused first, so allocation is a pointer pop in most cases.
+// Parent allocator receives whole chunk requests, not single nodes.
+template <Manual Type>
+class NodeSlab
+{
+private:
+    struct FreeNode
+    {
+        FreeNode *next;
+    };
+
+    struct Chunk
+    {
+        Chunk *next;
+    };
+
+    static constexpr USize FIRST_CHUNK_COUNT = 16;
+    static constexpr USize MAX_CHUNK_COUNT   = 4096;
+    static constexpr USize SLOT_ALIGNMENT    = std::max(alignof(Type), alignof(FreeNode));
+    static constexpr USize SLOT_SIZE         = Memory::align_offset(std::max(sizeof(Type), sizeof(FreeNode)),
+                                                                    SLOT_ALIGNMENT);
+    static constexpr USize HEADER_SIZE       = Memory::align_offset(sizeof(Chunk), SLOT_ALIGNMENT);
+
+    AllocatorInfo *allocatorInfo;
+    Chunk         *chunks;
+    FreeNode      *freeList;
+    Byte          *unusedBegin; // Never used part of newest chunk
+    Byte          *unusedEnd;
+    USize          nextChunkCount;
+
+public:
+    NodeSlab() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , chunks(nullptr)
+    , freeList(nullptr)
+    , unusedBegin(nullptr)
+    , unusedEnd(nullptr)
+    , nextChunkCount(FIRST_CHUNK_COUNT)
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo  = allocator;
+        chunks         = nullptr;
+        freeList       = nullptr;
+        unusedBegin    = nullptr;
+        unusedEnd      = nullptr;
+        nextChunkCount = FIRST_CHUNK_COUNT;
+    }
+
+    [[nodiscard]]
+    Type *allocate() noexcept
+    {
+        return Memory::start_object<Type>(take_slot());
+    }
+
+    // Starts node lifetime without calling constructor, used for sentinels
+    [[nodiscard]]
+    Type *allocate_uninitialized() noexcept
+    {
+        return Memory::start_object<Type, false>(take_slot());
+    }
+
+    Void deallocate(const Type *node) noexcept
+    {
+        assert(node && "Invalid pointer!");
+        FreeNode *freeNode = Memory::start_object<FreeNode, false>(byte_cast(const_cast<Type *>(node)));
+        freeNode->next = freeList;
+        freeList = freeNode;
+    }
+
+    [[nodiscard]]
+    AllocatorInfo *get_allocator_info() const noexcept
+    {
+        return allocatorInfo;
+    }
+
+    // Returns all chunks to parent allocator, every node allocated from this slab becomes invalid
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        while (chunks)
+        {
+            Chunk *toFree = chunks;
+            chunks = chunks->next;
+            allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(toFree));
+        }
+
+        *this = {};
+    }
+
+private:
+    Byte *take_slot() noexcept
+    {
+        if (freeList) [[likely]]
+        {
+            Byte *slot = byte_cast(freeList);
+            freeList = freeList->next;
+            return slot;
+        }
+
+        if (unusedBegin == unusedEnd) [[unlikely]]
+        {
+            grow();
+        }
+
+        Byte *slot = unusedBegin;
+        unusedBegin += SLOT_SIZE;
+        return slot;
+    }
+
+    Void grow() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        const USize bytes = HEADER_SIZE + nextChunkCount * SLOT_SIZE;
+        Byte *memory = allocatorInfo->allocate(allocatorInfo->allocator, bytes, SLOT_ALIGNMENT);
+        assert(memory && "Allocation failed!");
+
+        Chunk *chunk = Memory::start_object<Chunk, false>(memory);
+        chunk->next = chunks;
+        chunks = chunk;
+
+        unusedBegin = memory + HEADER_SIZE;
+        unusedEnd = memory + bytes;
+        nextChunkCount = std::min(nextChunkCount * 2, MAX_CHUNK_COUNT);
+    }
+};
\ No newline at end of file
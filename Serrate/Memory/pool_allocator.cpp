@@ -35,7 +35,7 @@ Void PoolAllocator::initialize(const USize count, const USize size) noexcept
 
 Void PoolAllocator::initialize(const USize count, const USize size, AllocatorInfo *allocatorInfo) noexcept
 {
-    assert(parentInfo != nullptr && "Parent allocator is nullptr!");
+    assert(allocatorInfo != nullptr && "Parent allocator is nullptr!");
     assert(size % sizeof(Void *) == 0 && "Block size must be divisible by max possible align type");
 
     blockSize = size;
@@ -0,0 +1,1144 @@
+#pragma once
+#include "string.hpp"
+#include "string_view.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Adaptive radix tree over key bytes. Inner nodes grow from 4 to 16, 48 and 256 children and shrink back
+// on removal, common key parts are compressed into node prefix. Keys are visited in byte order, which is
+// lexicographic order for Char keys. Wider characters are compared by their in-memory bytes. Leaves hold
+// whole key, so prefixes longer than MAX_PREFIX_SIZE are checked against a leaf.
+// Keys passed to callbacks are null terminated views of leaf memory.
+template <Character CharType, Manual ValueType>
+class BasicAdaptiveRadixTree
+{
+private:
+    using View = BasicStringView<CharType>;
+    using Text = BasicString<CharType>;
+
+    static constexpr USize MAX_PREFIX_SIZE = 8;
+
+    enum class ENodeType : UInt8
+    {
+        Node4,
+        Node16,
+        Node48,
+        Node256,
+    };
+
+    struct Leaf
+    {
+        ValueType value;
+        USize     keySize; // In bytes, without terminator
+    };
+
+    struct Node
+    {
+        ENodeType type;
+        UInt16    childCount;
+        UInt32    prefixLength;
+        Leaf     *terminal; // Key which ends exactly at this node
+        UInt8     prefix[MAX_PREFIX_SIZE];
+    };
+
+    struct Node4 : Node
+    {
+        UInt8 keys[4];
+        Node *children[4];
+    };
+
+    struct Node16 : Node
+    {
+        UInt8 keys[16];
+        Node *children[16];
+    };
+
+    struct Node48 : Node
+    {
+        UInt8 childIndex[256]; // 0 means empty, otherwise index + 1
+        Node *children[48];
+    };
+
+    struct Node256 : Node
+    {
+        Node *children[256];
+    };
+
+    struct Key
+    {
+        const UInt8 *data;
+        USize        size;
+    };
+
+public:
+    struct InsertResult
+    {
+        ValueType &value;
+        Bool       isInserted;
+    };
+
+private:
+    AllocatorInfo *allocatorInfo;
+    Node          *root; // Either inner node or tagged leaf
+    USize          size;
+
+public:
+    BasicAdaptiveRadixTree() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , root(nullptr)
+    , size(0)
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        root = nullptr;
+        size = 0;
+    }
+
+    [[nodiscard]]
+    ValueType *find(const View &key) const noexcept
+    {
+        Leaf *leaf = find_leaf(make_key(key));
+        return leaf ? &leaf->value : nullptr;
+    }
+
+    [[nodiscard]]
+    ValueType *find(const Text &key) const noexcept
+    {
+        Leaf *leaf = find_leaf(make_key(key));
+        return leaf ? &leaf->value : nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const View &key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const Text &key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    // Inserts or overwrites value
+    ValueType &push(const View &key, const ValueType &value) noexcept
+    {
+        return assign(find_or_insert(key).value, value);
+    }
+
+    ValueType &push(const Text &key, const ValueType &value) noexcept
+    {
+        return assign(find_or_insert(key).value, value);
+    }
+
+    // Inserts default value when key does not exist, isInserted tells which case happened
+    InsertResult find_or_insert(const View &key) noexcept
+    {
+        return insert(&root, make_key(key), 0);
+    }
+
+    InsertResult find_or_insert(const Text &key) noexcept
+    {
+        return insert(&root, make_key(key), 0);
+    }
+
+    Bool remove(const View &key) noexcept
+    {
+        return remove(&root, make_key(key), 0);
+    }
+
+    Bool remove(const Text &key) noexcept
+    {
+        return remove(&root, make_key(key), 0);
+    }
+
+    // Visits all entries in key order, function is called as function(const View &key, ValueType &value)
+    template <typename Function>
+    Void for_each(Function &&function) const noexcept
+    {
+        if (root)
+        {
+            visit(root, function);
+        }
+    }
+
+    // Visits entries whose key starts with prefix in key order
+    template <typename Function>
+    Void for_each_prefix(const View &prefix, Function &&function) const noexcept
+    {
+        const Key key = make_key(prefix);
+        Node *node = root;
+        USize depth = 0;
+        while (node)
+        {
+            if (is_leaf(node))
+            {
+                Leaf *leaf = get_leaf(node);
+                if (leaf->keySize >= key.size && std::memcmp(get_key_data(leaf), key.data, key.size) == 0)
+                {
+                    call(function, leaf);
+                }
+                return;
+            }
+
+            const USize compareSize = std::min(USize(node->prefixLength), key.size - depth);
+            const UInt8 *prefixData = get_full_prefix(node, depth);
+            if (std::memcmp(prefixData, key.data + depth, compareSize) != 0)
+            {
+                return;
+            }
+
+            depth += node->prefixLength;
+            if (depth >= key.size)
+            {
+                visit(node, function);
+                return;
+            }
+
+            Node **child = find_child(node, key.data[depth]);
+            node = child ? *child : nullptr;
+            ++depth;
+        }
+    }
+
+    // Visits entries with key in range [low, high) in key order
+    template <typename Function>
+    Void for_each_range(const View &low, const View &high, Function &&function) const noexcept
+    {
+        if (root)
+        {
+            const Key lowKey = make_key(low);
+            const Key highKey = make_key(high);
+            visit_range(root, 0, &lowKey, highKey, function);
+        }
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Void clear() noexcept
+    {
+        if (root)
+        {
+            release(root);
+        }
+        root = nullptr;
+        size = 0;
+    }
+
+    Void copy(const BasicAdaptiveRadixTree &source) noexcept
+    {
+        assert(this != &source && "Copying into itself!");
+        AllocatorInfo *allocator = source.allocatorInfo;
+        finalize();
+        initialize(allocator);
+        source.for_each([this](const View &key, const ValueType &value)
+        {
+            push(key, value);
+        });
+    }
+
+    Void move(BasicAdaptiveRadixTree &source) noexcept
+    {
+        assert(this != &source && "Moving into itself!");
+        finalize();
+        *this = source;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        clear();
+        *this = {};
+    }
+
+private:
+    [[nodiscard]]
+    static Key make_key(const View &key) noexcept
+    {
+        return { reinterpret_cast<const UInt8 *>(key.get_data()), key.get_size() * sizeof(CharType) };
+    }
+
+    [[nodiscard]]
+    static Key make_key(const Text &key) noexcept
+    {
+        return { reinterpret_cast<const UInt8 *>(key.get_data()), key.get_size() * sizeof(CharType) };
+    }
+
+    static ValueType &assign(ValueType &target, const ValueType &value) noexcept
+    {
+        if constexpr (Copyable<ValueType>)
+        {
+            if constexpr (Finalizable<ValueType>)
+            {
+                target.finalize();
+            }
+            target.copy(value);
+        } else {
+            target = value;
+        }
+        return target;
+    }
+
+    [[nodiscard]]
+    static Bool is_leaf(const Node *node) noexcept
+    {
+        return reinterpret_cast<USize>(node) & USize(1);
+    }
+
+    [[nodiscard]]
+    static Leaf *get_leaf(const Node *node) noexcept
+    {
+        return reinterpret_cast<Leaf *>(reinterpret_cast<USize>(node) & ~USize(1));
+    }
+
+    [[nodiscard]]
+    static Node *tag_leaf(Leaf *leaf) noexcept
+    {
+        return reinterpret_cast<Node *>(reinterpret_cast<USize>(leaf) | USize(1));
+    }
+
+    [[nodiscard]]
+    static UInt8 *get_key_data(Leaf *leaf) noexcept
+    {
+        return reinterpret_cast<UInt8 *>(leaf + 1);
+    }
+
+    [[nodiscard]]
+    static Bool equals(Leaf *leaf, const Key &key) noexcept
+    {
+        return leaf->keySize == key.size && std::memcmp(get_key_data(leaf), key.data, key.size) == 0;
+    }
+
+    template <typename Function>
+    static Void call(Function &function, Leaf *leaf) noexcept
+    {
+        View key;
+        key.initialize(reinterpret_cast<const CharType *>(get_key_data(leaf)), leaf->keySize / sizeof(CharType));
+        function(key, leaf->value);
+    }
+
+    Leaf *allocate_leaf(const Key &key) noexcept
+    {
+        constexpr USize alignment = std::max(alignof(Leaf), USize(2));
+        Byte *memory = allocatorInfo->allocate(allocatorInfo->allocator,
+                                               sizeof(Leaf) + key.size + sizeof(CharType),
+                                               alignment);
+        Leaf *leaf = Memory::start_object<Leaf>(memory);
+        leaf->keySize = key.size;
+        std::memcpy(get_key_data(leaf), key.data, key.size);
+        std::memset(get_key_data(leaf) + key.size, 0, sizeof(CharType));
+        return leaf;
+    }
+
+    Void deallocate_leaf(Leaf *leaf) noexcept
+    {
+        if constexpr (Finalizable<ValueType>)
+        {
+            leaf->value.finalize();
+        }
+        allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(leaf));
+    }
+
+    template <typename NodeType>
+    NodeType *allocate_node() noexcept
+    {
+        NodeType *node = Memory::allocate<NodeType, false>(allocatorInfo);
+        std::memset(static_cast<Void *>(node), 0, sizeof(NodeType));
+        if constexpr (std::is_same_v<NodeType, Node4>)
+        {
+            node->type = ENodeType::Node4;
+        }
+        else if constexpr (std::is_same_v<NodeType, Node16>)
+        {
+            node->type = ENodeType::Node16;
+        }
+        else if constexpr (std::is_same_v<NodeType, Node48>)
+        {
+            node->type = ENodeType::Node48;
+        } else {
+            node->type = ENodeType::Node256;
+        }
+        return node;
+    }
+
+    Void deallocate_node(Node *node) noexcept
+    {
+        allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(node));
+    }
+
+    // Copies header of old node into node that replaces it
+    static Void copy_header(Node *target, const Node *source) noexcept
+    {
+        target->childCount   = source->childCount;
+        target->prefixLength = source->prefixLength;
+        target->terminal     = source->terminal;
+        std::memcpy(target->prefix, source->prefix, MAX_PREFIX_SIZE);
+    }
+
+    // Smallest leaf under node, its key holds full prefix of every node on the way
+    [[nodiscard]]
+    static Leaf *get_minimum(const Node *node) noexcept
+    {
+        while (!is_leaf(node))
+        {
+            if (node->terminal)
+            {
+                return node->terminal;
+            }
+
+            switch (node->type)
+            {
+                case ENodeType::Node4:
+                    node = static_cast<const Node4 *>(node)->children[0];
+                    break;
+                case ENodeType::Node16:
+                    node = static_cast<const Node16 *>(node)->children[0];
+                    break;
+                case ENodeType::Node48:
+                {
+                    const Node48 *node48 = static_cast<const Node48 *>(node);
+                    USize index = 0;
+                    while (!node48->childIndex[index])
+                    {
+                        ++index;
+                    }
+                    node = node48->children[node48->childIndex[index] - 1];
+                    break;
+                }
+                case ENodeType::Node256:
+                {
+                    const Node256 *node256 = static_cast<const Node256 *>(node);
+                    USize index = 0;
+                    while (!node256->children[index])
+                    {
+                        ++index;
+                    }
+                    node = node256->children[index];
+                    break;
+                }
+            }
+        }
+        return get_leaf(node);
+    }
+
+    // Prefix bytes of node which starts at depth, long prefixes are read from a leaf
+    [[nodiscard]]
+    static const UInt8 *get_full_prefix(const Node *node, const USize depth) noexcept
+    {
+        if (node->prefixLength <= MAX_PREFIX_SIZE)
+        {
+            return node->prefix;
+        }
+        return get_key_data(get_minimum(node)) + depth;
+    }
+
+    // Number of prefix bytes that match key from depth
+    [[nodiscard]]
+    static USize get_prefix_mismatch(const Node *node, const Key &key, const USize depth) noexcept
+    {
+        const USize maxLength = std::min(USize(node->prefixLength), key.size - depth);
+        const UInt8 *prefixData = get_full_prefix(node, depth);
+        USize index = 0;
+        while (index < maxLength && prefixData[index] == key.data[depth + index])
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    [[nodiscard]]
+    static Node **find_child(Node *node, const UInt8 byte) noexcept
+    {
+        switch (node->type)
+        {
+            case ENodeType::Node4:
+            {
+                Node4 *node4 = static_cast<Node4 *>(node);
+                for (USize i = 0; i < node4->childCount; ++i)
+                {
+                    if (node4->keys[i] == byte)
+                    {
+                        return &node4->children[i];
+                    }
+                }
+                return nullptr;
+            }
+            case ENodeType::Node16:
+            {
+                Node16 *node16 = static_cast<Node16 *>(node);
+#if defined(_M_X64) || defined(__SSE2__)
+                const __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(Char(byte)),
+                                                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(node16->keys)));
+                const UInt32 mask = UInt32(_mm_movemask_epi8(matches)) & ((UInt32(1) << node16->childCount) - 1);
+                return mask ? &node16->children[std::countr_zero(mask)] : nullptr;
+#else
+                for (USize i = 0; i < node16->childCount; ++i)
+                {
+                    if (node16->keys[i] == byte)
+                    {
+                        return &node16->children[i];
+                    }
+                }
+                return nullptr;
+#endif
+            }
+            case ENodeType::Node48:
+            {
+                Node48 *node48 = static_cast<Node48 *>(node);
+                const UInt8 index = node48->childIndex[byte];
+                return index ? &node48->children[index - 1] : nullptr;
+            }
+            case ENodeType::Node256:
+            {
+                Node256 *node256 = static_cast<Node256 *>(node);
+                return node256->children[byte] ? &node256->children[byte] : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename NodeType>
+    static Void insert_sorted(NodeType *node, const UInt8 byte, Node *child) noexcept
+    {
+        USize index = 0;
+        while (index < node->childCount && node->keys[index] < byte)
+        {
+            ++index;
+        }
+        const USize tailCount = node->childCount - index;
+        std::memmove(node->keys + index + 1, node->keys + index, tailCount);
+        std::memmove(node->children + index + 1, node->children + index, tailCount * sizeof(Node *));
+        node->keys[index] = byte;
+        node->children[index] = child;
+        ++node->childCount;
+    }
+
+    // Adds child to node stored in slot, node is replaced by bigger one when full
+    Void add_child(Node **slot, const UInt8 byte, Node *child) noexcept
+    {
+        Node *node = *slot;
+        switch (node->type)
+        {
+            case ENodeType::Node4:
+            {
+                Node4 *node4 = static_cast<Node4 *>(node);
+                if (node4->childCount < 4)
+                {
+                    insert_sorted(node4, byte, child);
+                    return;
+                }
+
+                Node16 *node16 = allocate_node<Node16>();
+                copy_header(node16, node4);
+                std::memcpy(node16->keys, node4->keys, 4);
+                std::memcpy(node16->children, node4->children, 4 * sizeof(Node *));
+                insert_sorted(node16, byte, child);
+                deallocate_node(node4);
+                *slot = node16;
+                return;
+            }
+            case ENodeType::Node16:
+            {
+                Node16 *node16 = static_cast<Node16 *>(node);
+                if (node16->childCount < 16)
+                {
+                    insert_sorted(node16, byte, child);
+                    return;
+                }
+
+                Node48 *node48 = allocate_node<Node48>();
+                copy_header(node48, node16);
+                std::memcpy(node48->children, node16->children, 16 * sizeof(Node *));
+                for (USize i = 0; i < 16; ++i)
+                {
+                    node48->childIndex[node16->keys[i]] = UInt8(i + 1);
+                }
+                deallocate_node(node16);
+                *slot = node48;
+                add_child(slot, byte, child);
+                return;
+            }
+            case ENodeType::Node48:
+            {
+                Node48 *node48 = static_cast<Node48 *>(node);
+                if (node48->childCount < 48)
+                {
+                    USize index = 0;
+                    while (node48->children[index])
+                    {
+                        ++index;
+                    }
+                    node48->children[index] = child;
+                    node48->childIndex[byte] = UInt8(index + 1);
+                    ++node48->childCount;
+                    return;
+                }
+
+                Node256 *node256 = allocate_node<Node256>();
+                copy_header(node256, node48);
+                for (USize i = 0; i < 256; ++i)
+                {
+                    if (node48->childIndex[i])
+                    {
+                        node256->children[i] = node48->children[node48->childIndex[i] - 1];
+                    }
+                }
+                deallocate_node(node48);
+                *slot = node256;
+                add_child(slot, byte, child);
+                return;
+            }
+            case ENodeType::Node256:
+            {
+                Node256 *node256 = static_cast<Node256 *>(node);
+                node256->children[byte] = child;
+                ++node256->childCount;
+                return;
+            }
+        }
+    }
+
+    static Void remove_child(Node *node, const UInt8 byte) noexcept
+    {
+        switch (node->type)
+        {
+            case ENodeType::Node4:
+            case ENodeType::Node16:
+            {
+                UInt8 *keys = node->type == ENodeType::Node4 ? static_cast<Node4 *>(node)->keys
+                                                             : static_cast<Node16 *>(node)->keys;
+                Node **children = node->type == ENodeType::Node4 ? static_cast<Node4 *>(node)->children
+                                                                 : static_cast<Node16 *>(node)->children;
+                USize index = 0;
+                while (keys[index] != byte)
+                {
+                    ++index;
+                }
+                const USize tailCount = node->childCount - index - 1;
+                std::memmove(keys + index, keys + index + 1, tailCount);
+                std::memmove(children + index, children + index + 1, tailCount * sizeof(Node *));
+                break;
+            }
+            case ENodeType::Node48:
+            {
+                Node48 *node48 = static_cast<Node48 *>(node);
+                node48->children[node48->childIndex[byte] - 1] = nullptr;
+                node48->childIndex[byte] = 0;
+                break;
+            }
+            case ENodeType::Node256:
+            {
+                static_cast<Node256 *>(node)->children[byte] = nullptr;
+                break;
+            }
+        }
+        --node->childCount;
+    }
+
+    // Replaces node in slot with smaller one when it has too few children
+    Void shrink(Node **slot) noexcept
+    {
+        Node *node = *slot;
+        switch (node->type)
+        {
+            case ENodeType::Node4:
+            {
+                Node4 *node4 = static_cast<Node4 *>(node);
+                if (node4->childCount == 0)
+                {
+                    *slot = node4->terminal ? tag_leaf(node4->terminal) : nullptr;
+                    deallocate_node(node4);
+                }
+                else if (node4->childCount == 1 && !node4->terminal)
+                {
+                    Node *child = node4->children[0];
+                    if (!is_leaf(child))
+                    {
+                        // Child prefix becomes node prefix, edge byte and old child prefix
+                        UInt8 prefix[MAX_PREFIX_SIZE];
+                        USize prefixSize = std::min(USize(node4->prefixLength), MAX_PREFIX_SIZE);
+                        std::memcpy(prefix, node4->prefix, prefixSize);
+                        if (prefixSize < MAX_PREFIX_SIZE)
+                        {
+                            prefix[prefixSize++] = node4->keys[0];
+                        }
+                        const USize childPrefixSize = std::min(USize(child->prefixLength),
+                                                               MAX_PREFIX_SIZE - prefixSize);
+                        std::memcpy(prefix + prefixSize, child->prefix, childPrefixSize);
+                        prefixSize += childPrefixSize;
+
+                        std::memcpy(child->prefix, prefix, prefixSize);
+                        child->prefixLength += node4->prefixLength + 1;
+                    }
+                    *slot = child;
+                    deallocate_node(node4);
+                }
+                return;
+            }
+            case ENodeType::Node16:
+            {
+                Node16 *node16 = static_cast<Node16 *>(node);
+                if (node16->childCount > 3)
+                {
+                    return;
+                }
+
+                Node4 *node4 = allocate_node<Node4>();
+                copy_header(node4, node16);
+                std::memcpy(node4->keys, node16->keys, node16->childCount);
+                std::memcpy(node4->children, node16->children, node16->childCount * sizeof(Node *));
+                deallocate_node(node16);
+                *slot = node4;
+                return;
+            }
+            case ENodeType::Node48:
+            {
+                Node48 *node48 = static_cast<Node48 *>(node);
+                if (node48->childCount > 12)
+                {
+                    return;
+                }
+
+                Node16 *node16 = allocate_node<Node16>();
+                copy_header(node16, node48);
+                USize count = 0;
+                for (USize i = 0; i < 256; ++i)
+                {
+                    if (node48->childIndex[i])
+                    {
+                        node16->keys[count] = UInt8(i);
+                        node16->children[count] = node48->children[node48->childIndex[i] - 1];
+                        ++count;
+                    }
+                }
+                deallocate_node(node48);
+                *slot = node16;
+                return;
+            }
+            case ENodeType::Node256:
+            {
+                Node256 *node256 = static_cast<Node256 *>(node);
+                if (node256->childCount > 37)
+                {
+                    return;
+                }
+
+                Node48 *node48 = allocate_node<Node48>();
+                copy_header(node48, node256);
+                USize count = 0;
+                for (USize i = 0; i < 256; ++i)
+                {
+                    if (node256->children[i])
+                    {
+                        node48->children[count] = node256->children[i];
+                        node48->childIndex[i] = UInt8(count + 1);
+                        ++count;
+                    }
+                }
+                deallocate_node(node256);
+                *slot = node48;
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]]
+    Leaf *find_leaf(const Key &key) const noexcept
+    {
+        Node *node = root;
+        USize depth = 0;
+        while (node)
+        {
+            if (is_leaf(node))
+            {
+                Leaf *leaf = get_leaf(node);
+                return equals(leaf, key) ? leaf : nullptr;
+            }
+
+            // Only stored prefix bytes are compared, final leaf check catches the rest
+            const USize storedSize = std::min(USize(node->prefixLength), MAX_PREFIX_SIZE);
+            if (key.size - depth < node->prefixLength
+                || std::memcmp(node->prefix, key.data + depth, storedSize) != 0)
+            {
+                return nullptr;
+            }
+            depth += node->prefixLength;
+
+            if (depth == key.size)
+            {
+                return node->terminal && equals(node->terminal, key) ? node->terminal : nullptr;
+            }
+
+            Node **child = find_child(node, key.data[depth]);
+            node = child ? *child : nullptr;
+            ++depth;
+        }
+        return nullptr;
+    }
+
+    InsertResult insert(Node **slot, const Key &key, USize depth) noexcept
+    {
+        while (true)
+        {
+            Node *node = *slot;
+            if (!node)
+            {
+                Leaf *leaf = allocate_leaf(key);
+                *slot = tag_leaf(leaf);
+                ++size;
+                return { leaf->value, true };
+            }
+
+            if (is_leaf(node))
+            {
+                Leaf *existing = get_leaf(node);
+                if (equals(existing, key))
+                {
+                    return { existing->value, false };
+                }
+
+                // Both keys go under new node which holds their common part
+                const UInt8 *existingKey = get_key_data(existing);
+                const USize maxLength = std::min(existing->keySize, key.size);
+                USize commonLength = depth;
+                while (commonLength < maxLength && existingKey[commonLength] == key.data[commonLength])
+                {
+                    ++commonLength;
+                }
+
+                Node4 *newNode = allocate_node<Node4>();
+                newNode->prefixLength = UInt32(commonLength - depth);
+                std::memcpy(newNode->prefix, key.data + depth, std::min(USize(newNode->prefixLength), MAX_PREFIX_SIZE));
+                *slot = newNode;
+                attach_leaf(slot, existing, commonLength);
+
+                Leaf *leaf = allocate_leaf(key);
+                attach_leaf(slot, leaf, commonLength);
+                ++size;
+                return { leaf->value, true };
+            }
+
+            if (node->prefixLength)
+            {
+                const USize mismatch = get_prefix_mismatch(node, key, depth);
+                if (mismatch < node->prefixLength)
+                {
+                    split_prefix(slot, depth, mismatch);
+                    Leaf *leaf = allocate_leaf(key);
+                    attach_leaf(slot, leaf, depth + mismatch);
+                    ++size;
+                    return { leaf->value, true };
+                }
+                depth += node->prefixLength;
+            }
+
+            if (depth == key.size)
+            {
+                if (node->terminal)
+                {
+                    return { node->terminal->value, false };
+                }
+                Leaf *leaf = allocate_leaf(key);
+                node->terminal = leaf;
+                ++size;
+                return { leaf->value, true };
+            }
+
+            Node **child = find_child(node, key.data[depth]);
+            if (!child)
+            {
+                Leaf *leaf = allocate_leaf(key);
+                add_child(slot, key.data[depth], tag_leaf(leaf));
+                ++size;
+                return { leaf->value, true };
+            }
+
+            slot = child;
+            ++depth;
+        }
+    }
+
+    // Places leaf into node in slot, whose prefix ends at depth
+    Void attach_leaf(Node **slot, Leaf *leaf, const USize depth) noexcept
+    {
+        if (leaf->keySize == depth)
+        {
+            (*slot)->terminal = leaf;
+        } else {
+            add_child(slot, get_key_data(leaf)[depth], tag_leaf(leaf));
+        }
+    }
+
+    // Puts new node with first mismatch bytes of prefix above node in slot
+    Void split_prefix(Node **slot, const USize depth, const USize mismatch) noexcept
+    {
+        Node *node = *slot;
+        const UInt8 *prefixData = get_full_prefix(node, depth);
+
+        Node4 *newNode = allocate_node<Node4>();
+        newNode->prefixLength = UInt32(mismatch);
+        std::memcpy(newNode->prefix, prefixData, std::min(mismatch, MAX_PREFIX_SIZE));
+
+        const UInt8 edge = prefixData[mismatch];
+        const USize remainingLength = node->prefixLength - mismatch - 1;
+        UInt8 remaining[MAX_PREFIX_SIZE];
+        std::memcpy(remaining, prefixData + mismatch + 1, std::min(remainingLength, MAX_PREFIX_SIZE));
+        std::memcpy(node->prefix, remaining, std::min(remainingLength, MAX_PREFIX_SIZE));
+        node->prefixLength = UInt32(remainingLength);
+
+        *slot = newNode;
+        add_child(slot, edge, node);
+    }
+
+    Bool remove(Node **slot, const Key &key, USize depth) noexcept
+    {
+        Node *node = *slot;
+        if (!node)
+        {
+            return false;
+        }
+
+        if (is_leaf(node))
+        {
+            Leaf *leaf = get_leaf(node);
+            if (!equals(leaf, key))
+            {
+                return false;
+            }
+            deallocate_leaf(leaf);
+            *slot = nullptr;
+            --size;
+            return true;
+        }
+
+        const USize storedSize = std::min(USize(node->prefixLength), MAX_PREFIX_SIZE);
+        if (key.size - depth < node->prefixLength
+            || std::memcmp(node->prefix, key.data + depth, storedSize) != 0)
+        {
+            return false;
+        }
+        depth += node->prefixLength;
+
+        if (depth == key.size)
+        {
+            if (!node->terminal || !equals(node->terminal, key))
+            {
+                return false;
+            }
+            deallocate_leaf(node->terminal);
+            node->terminal = nullptr;
+            --size;
+            shrink(slot);
+            return true;
+        }
+
+        const UInt8 byte = key.data[depth];
+        Node **child = find_child(node, byte);
+        if (!child || !remove(child, key, depth + 1))
+        {
+            return false;
+        }
+
+        if (!*child)
+        {
+            remove_child(node, byte);
+            shrink(slot);
+        }
+        return true;
+    }
+
+    // Calls function on children of node in byte order, stops when function returns false
+    template <typename Function>
+    static Bool for_each_child(const Node *node, Function &&function) noexcept
+    {
+        switch (node->type)
+        {
+            case ENodeType::Node4:
+            {
+                const Node4 *node4 = static_cast<const Node4 *>(node);
+                for (USize i = 0; i < node4->childCount; ++i)
+                {
+                    if (!function(node4->keys[i], node4->children[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case ENodeType::Node16:
+            {
+                const Node16 *node16 = static_cast<const Node16 *>(node);
+                for (USize i = 0; i < node16->childCount; ++i)
+                {
+                    if (!function(node16->keys[i], node16->children[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case ENodeType::Node48:
+            {
+                const Node48 *node48 = static_cast<const Node48 *>(node);
+                for (USize i = 0; i < 256; ++i)
+                {
+                    if (node48->childIndex[i] && !function(UInt8(i), node48->children[node48->childIndex[i] - 1]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case ENodeType::Node256:
+            {
+                const Node256 *node256 = static_cast<const Node256 *>(node);
+                for (USize i = 0; i < 256; ++i)
+                {
+                    if (node256->children[i] && !function(UInt8(i), node256->children[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+        return true;
+    }
+
+    template <typename Function>
+    static Void visit(const Node *node, Function &function) noexcept
+    {
+        if (is_leaf(node))
+        {
+            call(function, get_leaf(node));
+            return;
+        }
+
+        if (node->terminal)
+        {
+            call(function, node->terminal);
+        }
+        for_each_child(node, [&function](UInt8, const Node *child)
+        {
+            visit(child, function);
+            return true;
+        });
+    }
+
+    // Returns false once key reached high, low is nullptr when whole subtree is not less than it
+    template <typename Function>
+    static Bool visit_range(const Node *node, USize depth, const Key *low, const Key &high,
+                            Function &function) noexcept
+    {
+        if (is_leaf(node))
+        {
+            Leaf *leaf = get_leaf(node);
+            if (low && compare(leaf, *low) < 0)
+            {
+                return true;
+            }
+            if (compare(leaf, high) >= 0)
+            {
+                return false;
+            }
+            call(function, leaf);
+            return true;
+        }
+
+        if (low)
+        {
+            const UInt8 *prefixData = get_full_prefix(node, depth);
+            for (USize i = 0; i < node->prefixLength; ++i)
+            {
+                if (depth + i >= low->size || prefixData[i] > low->data[depth + i])
+                {
+                    low = nullptr;
+                    break;
+                }
+                if (prefixData[i] < low->data[depth + i])
+                {
+                    return true;
+                }
+            }
+        }
+        depth += node->prefixLength;
+
+        if (node->terminal && !visit_range(tag_leaf(node->terminal), depth, low, high, function))
+        {
+            return false;
+        }
+
+        if (low && depth >= low->size)
+        {
+            low = nullptr;
+        }
+        return for_each_child(node, [&](const UInt8 byte, const Node *child)
+        {
+            if (!low)
+            {
+                return visit_range(child, depth + 1, nullptr, high, function);
+            }
+            if (byte < low->data[depth])
+            {
+                return true;
+            }
+            return visit_range(child, depth + 1, byte == low->data[depth] ? low : nullptr, high, function);
+        });
+    }
+
+    [[nodiscard]]
+    static Int32 compare(Leaf *leaf, const Key &key) noexcept
+    {
+        const Int32 result = std::memcmp(get_key_data(leaf), key.data, std::min(leaf->keySize, key.size));
+        if (result != 0)
+        {
+            return result;
+        }
+        return leaf->keySize < key.size ? -1 : (leaf->keySize > key.size ? 1 : 0);
+    }
+
+    Void release(Node *node) noexcept
+    {
+        if (is_leaf(node))
+        {
+            deallocate_leaf(get_leaf(node));
+            return;
+        }
+
+        if (node->terminal)
+        {
+            deallocate_leaf(node->terminal);
+        }
+        for_each_child(node, [this](UInt8, Node *child)
+        {
+            release(child);
+            return true;
+        });
+        deallocate_node(node);
+    }
+};
+
+template <Manual ValueType>
+using AdaptiveRadixTree = BasicAdaptiveRadixTree<Char, ValueType>;
\ No newline at end of file
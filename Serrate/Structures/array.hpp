@@ -1,8 +1,10 @@
 #pragma once
 #include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/simd.hpp"
 
 #include <cassert>
 #include <concepts>
+#include <type_traits>
 
 template <Manual Type, USize Size>
 class Array
@@ -70,6 +72,15 @@ public:
 
     constexpr Void fill(const Type &value) noexcept
     {
+        if constexpr (Simd::Arithmetic<Type>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                Simd::fill(elements, Size, value);
+                return;
+            }
+        }
+
         if constexpr (Copyable<Type>)
         {
             Type *data = elements;
@@ -91,7 +102,7 @@ public:
     Void swap(USize left, USize right) noexcept
     {
         assert(left < Size && right < Size);
-        const Type &temporary = elements[left];
+        const Type temporary = elements[left];
         elements[left] = elements[right];
         elements[right] = temporary;
     }
@@ -99,6 +110,14 @@ public:
     [[nodiscard]]
     constexpr Bool contains(const Type &value) const noexcept
     {
+        if constexpr (Simd::Arithmetic<Type>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Simd::contains(elements, Size, value);
+            }
+        }
+
         for (USize i = 0; i < Size; ++i)
         {
             if (elements[i] == value)
@@ -0,0 +1,248 @@
+#pragma once
+#include "hash_map.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/cryptography.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <bit>
+
+// Blocked Bloom filter, every key sets all its bits inside one cache line sized block, so insert and
+// lookup touch single cache line. Block is chosen by upper half of XXH3 hash, bits inside block come from
+// double hashing of lower half. It never reports false negatives, false positive rate is given in initialize,
+// blocked layout makes real rate slightly higher than for classic Bloom filter of the same size.
+template <Hashable KeyType>
+class BloomFilter
+{
+private:
+    static constexpr UInt64 MAGIC           = 0x4D4F4C4253524553; // "SERSBLOM"
+    static constexpr USize  BITS_PER_BLOCK  = Memory::CACHE_LINE_SIZE * USize(8);
+    static constexpr USize  WORDS_PER_BLOCK = BITS_PER_BLOCK / USize(64);
+    static constexpr USize  MAX_HASH_COUNT  = 16;
+    static constexpr USize  BATCH_SIZE      = 16;
+
+    struct alignas(Memory::CACHE_LINE_SIZE) Block
+    {
+        UInt64 words[WORDS_PER_BLOCK];
+    };
+
+    struct Header
+    {
+        UInt64 magic;
+        UInt64 blockCount;
+        UInt64 hashCount;
+        UInt64 insertedCount;
+    };
+
+    AllocatorInfo *allocatorInfo;
+    Block         *blocks;
+    USize          blockCount;
+    USize          hashCount;
+    USize          insertedCount;
+
+public:
+    BloomFilter() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , blocks(nullptr)
+    , blockCount(0)
+    , hashCount(0)
+    , insertedCount(0)
+    {}
+
+    // Sizes filter for expected key count, falsePositiveRate is in range (0, 1)
+    Void initialize(const USize expectedCount, const Float64 falsePositiveRate,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(falsePositiveRate > 0.0 && falsePositiveRate < 1.0 && "False positive rate should be in (0, 1)!");
+        const Float64 ln2 = std::log(2.0);
+        const Float64 bitsPerKey = -std::log(falsePositiveRate) / (ln2 * ln2);
+        const USize bits = USize(std::ceil(Float64(std::max(expectedCount, USize(1))) * bitsPerKey));
+        const USize hashes = USize(std::lround(bitsPerKey * ln2));
+        initialize_blocks((bits + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK,
+                          std::clamp(hashes, USize(1), MAX_HASH_COUNT),
+                          allocator);
+    }
+
+    Void insert(const KeyType &key) noexcept
+    {
+        const UInt64 hash = mix(key);
+        Block &block = blocks[get_block(hash)];
+        UInt32 first = UInt32(hash);
+        const UInt32 second = UInt32(hash >> 17) | UInt32(1);
+        for (USize i = 0; i < hashCount; ++i, first += second)
+        {
+            const USize bit = first % BITS_PER_BLOCK;
+            block.words[bit / 64] |= UInt64(1) << (bit % 64);
+        }
+        ++insertedCount;
+    }
+
+    // False means key was never inserted, true means it probably was
+    [[nodiscard]]
+    Bool may_contain(const KeyType &key) const noexcept
+    {
+        const UInt64 hash = mix(key);
+        return test_block(blocks[get_block(hash)], hash);
+    }
+
+    // Hashes and prefetches blocks of a whole group before testing any of them
+    Void may_contain_batch(const KeyType *keys, const USize count, Bool *results) const noexcept
+    {
+        assert(((keys && results) || count == 0) && "Invalid pointer!");
+        UInt64 hashes[BATCH_SIZE];
+        for (USize offset = 0; offset < count; offset += BATCH_SIZE)
+        {
+            const USize groupCount = std::min(count - offset, BATCH_SIZE);
+            for (USize i = 0; i < groupCount; ++i)
+            {
+                hashes[i] = mix(keys[offset + i]);
+                Memory::prefetch(blocks + get_block(hashes[i]));
+            }
+
+            for (USize i = 0; i < groupCount; ++i)
+            {
+                results[offset + i] = test_block(blocks[get_block(hashes[i])], hashes[i]);
+            }
+        }
+    }
+
+    // Rough estimate of current false positive rate, assumes inserted keys were distinct
+    [[nodiscard]]
+    Float64 get_false_positive_rate() const noexcept
+    {
+        const Float64 bits = Float64(blockCount * BITS_PER_BLOCK);
+        const Float64 setRatio = 1.0 - std::exp(-Float64(hashCount * insertedCount) / bits);
+        return std::pow(setRatio, Float64(hashCount));
+    }
+
+    [[nodiscard]]
+    USize get_inserted_count() const noexcept
+    {
+        return insertedCount;
+    }
+
+    [[nodiscard]]
+    USize get_bit_count() const noexcept
+    {
+        return blockCount * BITS_PER_BLOCK;
+    }
+
+    [[nodiscard]]
+    USize get_hash_count() const noexcept
+    {
+        return hashCount;
+    }
+
+    Void clear() noexcept
+    {
+        std::memset(static_cast<Void *>(blocks), 0, blockCount * sizeof(Block));
+        insertedCount = 0;
+    }
+
+    [[nodiscard]]
+    USize get_serialized_size() const noexcept
+    {
+        return sizeof(Header) + blockCount * sizeof(Block);
+    }
+
+    // Destination has to hold get_serialized_size() bytes
+    Void serialize(Byte *destination) const noexcept
+    {
+        assert(destination && "Invalid pointer!");
+        const Header header = {
+            .magic         = MAGIC,
+            .blockCount    = blockCount,
+            .hashCount     = hashCount,
+            .insertedCount = insertedCount
+        };
+        std::memcpy(destination, &header, sizeof(Header));
+        std::memcpy(destination + sizeof(Header), blocks, blockCount * sizeof(Block));
+    }
+
+    // Initializes filter from bytes written by serialize, returns false when bytes are not a valid filter.
+    // Storage of already initialized filter is released first, failed call leaves filter untouched
+    [[nodiscard]]
+    Bool deserialize(const Byte *source, const USize bytes,
+                     AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(source && "Invalid pointer!");
+        if (bytes < sizeof(Header))
+        {
+            return false;
+        }
+
+        Header header;
+        std::memcpy(&header, source, sizeof(Header));
+        if (header.magic != MAGIC || header.blockCount == 0
+            || header.hashCount == 0 || header.hashCount > MAX_HASH_COUNT
+            || (bytes - sizeof(Header)) % sizeof(Block) != 0
+            || (bytes - sizeof(Header)) / sizeof(Block) != header.blockCount)
+        {
+            return false;
+        }
+
+        finalize();
+        initialize_blocks(USize(header.blockCount), USize(header.hashCount), allocator);
+        std::memcpy(static_cast<Void *>(blocks), source + sizeof(Header), blockCount * sizeof(Block));
+        insertedCount = USize(header.insertedCount);
+        return true;
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if (blocks)
+        {
+            allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(blocks));
+        }
+
+        *this = {};
+    }
+
+private:
+    Void initialize_blocks(const USize newBlockCount, const USize newHashCount, AllocatorInfo *allocator) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        blockCount = std::max(newBlockCount, USize(1));
+        hashCount = newHashCount;
+        insertedCount = 0;
+        blocks = reinterpret_cast<Block *>(allocatorInfo->allocate(allocatorInfo->allocator,
+                                                                   blockCount * sizeof(Block),
+                                                                   alignof(Block)));
+        assert(blocks && "Allocation failed!");
+        clear();
+    }
+
+    // hash_key is identity for integers, so it is always finished with XXH3
+    [[nodiscard]]
+    static UInt64 mix(const KeyType &key) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        return Cryptography::hash(&hash, 1);
+    }
+
+    [[nodiscard]]
+    USize get_block(const UInt64 hash) const noexcept
+    {
+        return USize((UInt64(UInt32(hash >> 32)) * blockCount) >> 32);
+    }
+
+    [[nodiscard]]
+    Bool test_block(const Block &block, const UInt64 hash) const noexcept
+    {
+        UInt32 first = UInt32(hash);
+        const UInt32 second = UInt32(hash >> 17) | UInt32(1);
+        for (USize i = 0; i < hashCount; ++i, first += second)
+        {
+            const USize bit = first % BITS_PER_BLOCK;
+            if ((block.words[bit / 64] & (UInt64(1) << (bit % 64))) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,966 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/search.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+// B+ tree, keys and values live only in leaves which are linked for range iteration, inner nodes hold
+// separator keys. Nodes are NodeBytes wide so one node covers several cache lines of keys and is searched
+// with branchless binary search. Leaf and inner nodes are allocated with the same size and alignment,
+// so PoolAllocator with get_node_size() blocks can back the whole tree.
+// Separator keys are owned copies of leaf keys, they stay valid after the leaf key they came from is removed.
+template <Ordered KeyType, Manual ValueType, USize NodeBytes = 256>
+requires Manual<KeyType>
+class BTreeMap
+{
+private:
+    static constexpr Bool HAS_VALUES = !std::is_empty_v<ValueType>;
+
+    struct Node
+    {
+        UInt32 count;
+        Bool   isLeaf;
+    };
+
+    static constexpr USize LEAF_ENTRY_SIZE = sizeof(KeyType) + (HAS_VALUES ? sizeof(ValueType) : 0);
+    static constexpr USize LEAF_CAPACITY = std::max((NodeBytes - sizeof(Node) - 2 * sizeof(Void *)) / LEAF_ENTRY_SIZE,
+                                                    USize(4));
+    static constexpr USize INNER_CAPACITY = std::max((NodeBytes - sizeof(Node) - sizeof(Void *))
+                                                     / (sizeof(KeyType) + sizeof(Void *)),
+                                                     USize(4));
+    static constexpr USize LEAF_MIN = LEAF_CAPACITY / 2;
+    static constexpr USize INNER_MIN = INNER_CAPACITY / 2;
+    static constexpr USize MAX_HEIGHT = 48; // Inner node has at least 3 children, so 3^48 keys would be needed
+
+    struct Leaf : Node
+    {
+        KeyType   keys[LEAF_CAPACITY];
+        ValueType values[HAS_VALUES ? LEAF_CAPACITY : 1];
+        Leaf     *previous;
+        Leaf     *next;
+    };
+
+    struct Inner : Node
+    {
+        KeyType keys[INNER_CAPACITY];
+        Node   *children[INNER_CAPACITY + 1];
+    };
+
+    static constexpr USize NODE_ALIGNMENT = std::max(alignof(Leaf), alignof(Inner));
+    static constexpr USize NODE_SIZE = Memory::align_offset(std::max(sizeof(Leaf), sizeof(Inner)),
+                                                            std::max(NODE_ALIGNMENT, sizeof(Void *)));
+
+    // Inner nodes visited from root to leaf and child index taken in each of them
+    struct Path
+    {
+        Inner *nodes[MAX_HEIGHT];
+        USize  indices[MAX_HEIGHT];
+        USize  depth;
+    };
+
+public:
+    struct InsertResult
+    {
+        ValueType &value;
+        Bool       isInserted;
+    };
+
+    struct Iterator
+    {
+    private:
+        Leaf *leaf;
+        USize index;
+
+    public:
+        Iterator() noexcept
+        : leaf(nullptr)
+        , index(0)
+        {}
+
+        Iterator(Leaf *initialLeaf, const USize initialIndex) noexcept
+        : leaf(initialLeaf)
+        , index(initialIndex)
+        {}
+
+        [[nodiscard]]
+        const KeyType &get_key() const noexcept
+        {
+            return leaf->keys[index];
+        }
+
+        [[nodiscard]]
+        ValueType &get_value() noexcept
+        {
+            return leaf->values[HAS_VALUES ? index : 0];
+        }
+
+        [[nodiscard]]
+        const ValueType &get_value() const noexcept
+        {
+            return leaf->values[HAS_VALUES ? index : 0];
+        }
+
+        ValueType &operator*() noexcept
+        {
+            return get_value();
+        }
+
+        const ValueType &operator*() const noexcept
+        {
+            return get_value();
+        }
+
+        ValueType *operator->() noexcept
+        {
+            return &get_value();
+        }
+
+        const ValueType *operator->() const noexcept
+        {
+            return &get_value();
+        }
+
+        Void operator++() noexcept
+        {
+            if (++index == leaf->count)
+            {
+                leaf = leaf->next;
+                index = 0;
+            }
+        }
+
+        // Decrementing begin() is undefined, use BTreeMap::last() to start backward iteration
+        Void operator--() noexcept
+        {
+            if (index == 0)
+            {
+                leaf = leaf->previous;
+                index = leaf->count;
+            }
+            --index;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return leaf == other.leaf && index == other.index;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+
+private:
+    AllocatorInfo *allocatorInfo;
+    Node          *root;
+    Leaf          *firstLeaf;
+    Leaf          *lastLeaf;
+    USize          size;
+    USize          height; // Number of inner levels
+
+public:
+    BTreeMap() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , root(nullptr)
+    , firstLeaf(nullptr)
+    , lastLeaf(nullptr)
+    , size(0)
+    , height(0)
+    {}
+
+    // Block size PoolAllocator needs to serve this tree
+    [[nodiscard]]
+    static constexpr USize get_node_size() noexcept
+    {
+        return NODE_SIZE;
+    }
+
+    [[nodiscard]]
+    static constexpr USize get_leaf_capacity() noexcept
+    {
+        return LEAF_CAPACITY;
+    }
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        size = 0;
+        height = 0;
+        firstLeaf = allocate_leaf();
+        lastLeaf = firstLeaf;
+        root = firstLeaf;
+    }
+
+    // Builds tree bottom up from strictly increasing keys, leaves are filled almost fully.
+    // Values can be nullptr for sets.
+    Void initialize(const KeyType *keys, const ValueType *values, const USize count,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert((keys || count == 0) && "Invalid pointer!");
+        assert((values || !HAS_VALUES || count == 0) && "Invalid pointer!");
+        if (count <= LEAF_CAPACITY)
+        {
+            initialize(allocator);
+            for (USize i = 0; i < count; ++i)
+            {
+                assert((i == 0 || keys[i - 1] < keys[i]) && "Keys should be sorted and unique!");
+                copy_into(firstLeaf->keys[i], keys[i]);
+                if constexpr (HAS_VALUES)
+                {
+                    copy_into(firstLeaf->values[i], values[i]);
+                }
+            }
+            firstLeaf->count = UInt32(count);
+            size = count;
+            return;
+        }
+
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        size = count;
+        height = 0;
+
+        // Scratch list of one level, next level is written over it from the front
+        const USize leafCount = (count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+        Node **level = reinterpret_cast<Node **>(allocatorInfo->allocate(allocatorInfo->allocator,
+                                                                         leafCount * sizeof(Node *),
+                                                                         alignof(Node *)));
+        assert(level && "Allocation failed!");
+
+        Leaf *previous = nullptr;
+        USize source = 0;
+        for (USize i = 0; i < leafCount; ++i)
+        {
+            // Spreads remainder so every leaf holds at least LEAF_MIN entries
+            const USize leafSize = count / leafCount + (i < count % leafCount ? 1 : 0);
+            Leaf *leaf = allocate_leaf();
+            for (USize j = 0; j < leafSize; ++j, ++source)
+            {
+                assert((source == 0 || keys[source - 1] < keys[source]) && "Keys should be sorted and unique!");
+                copy_into(leaf->keys[j], keys[source]);
+                if constexpr (HAS_VALUES)
+                {
+                    copy_into(leaf->values[j], values[source]);
+                }
+            }
+            leaf->count = UInt32(leafSize);
+            leaf->previous = previous;
+            if (previous)
+            {
+                previous->next = leaf;
+            } else {
+                firstLeaf = leaf;
+            }
+            previous = leaf;
+            level[i] = leaf;
+        }
+        lastLeaf = previous;
+
+        USize levelCount = leafCount;
+        while (levelCount > 1)
+        {
+            const USize innerCount = (levelCount + INNER_CAPACITY) / (INNER_CAPACITY + 1);
+            USize child = 0;
+            for (USize i = 0; i < innerCount; ++i)
+            {
+                const USize childCount = levelCount / innerCount + (i < levelCount % innerCount ? 1 : 0);
+                Inner *inner = allocate_inner();
+                for (USize j = 0; j < childCount; ++j, ++child)
+                {
+                    inner->children[j] = level[child];
+                    if (j > 0)
+                    {
+                        copy_into(inner->keys[j - 1], get_min_key(level[child]));
+                    }
+                }
+                inner->count = UInt32(childCount - 1);
+                level[i] = inner;
+            }
+            levelCount = innerCount;
+            ++height;
+        }
+
+        root = level[0];
+        allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(level));
+    }
+
+    [[nodiscard]]
+    ValueType *find(const KeyType &key) noexcept
+    {
+        Leaf *leaf = find_leaf(key);
+        const USize index = Search::find(leaf->keys, USize(leaf->count), key);
+        return index != ~USize(0) ? &leaf->values[HAS_VALUES ? index : 0] : nullptr;
+    }
+
+    [[nodiscard]]
+    const ValueType *find(const KeyType &key) const noexcept
+    {
+        return const_cast<BTreeMap *>(this)->find(key);
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    [[nodiscard]]
+    ValueType &operator[](const KeyType &key) noexcept
+    {
+        return find_or_insert(key).value;
+    }
+
+    [[nodiscard]]
+    const ValueType &operator[](const KeyType &key) const noexcept
+    {
+        const ValueType *value = find(key);
+        assert(value && "Key not found!");
+        return *value;
+    }
+
+    // Inserts or overwrites value
+    ValueType &push(const KeyType &key, const ValueType &value) noexcept
+    {
+        InsertResult result = find_or_insert(key);
+        if constexpr (HAS_VALUES)
+        {
+            if constexpr (Finalizable<ValueType>)
+            {
+                result.value.finalize();
+            }
+            copy_into(result.value, value);
+        }
+        return result.value;
+    }
+
+    // Inserts default value when key does not exist, isInserted tells which case happened
+    InsertResult find_or_insert(const KeyType &key) noexcept
+    {
+        Path path;
+        Leaf *leaf = descend(key, path);
+        const USize index = Search::lower_bound(leaf->keys, USize(leaf->count), key);
+        if (index < leaf->count && !(key < leaf->keys[index]))
+        {
+            return { leaf->values[HAS_VALUES ? index : 0], false };
+        }
+
+        ++size;
+        if (leaf->count < LEAF_CAPACITY)
+        {
+            insert_into_leaf(leaf, index, key);
+            return { leaf->values[HAS_VALUES ? index : 0], true };
+        }
+
+        // Left half keeps leaf->count entries after split, key landed in right half when index is past them
+        Leaf *right = split_leaf(leaf, index, key);
+        KeyType separator;
+        copy_into(separator, right->keys[0]);
+        insert_into_parent(path, separator, right);
+        if (index >= leaf->count)
+        {
+            return { right->values[HAS_VALUES ? index - leaf->count : 0], true };
+        }
+        return { leaf->values[HAS_VALUES ? index : 0], true };
+    }
+
+    Bool remove(const KeyType &key) noexcept
+    {
+        Path path;
+        Leaf *leaf = descend(key, path);
+        const USize index = Search::find(leaf->keys, USize(leaf->count), key);
+        if (index == ~USize(0))
+        {
+            return false;
+        }
+
+        finalize_entry(leaf, index);
+        erase_from_leaf(leaf, index);
+        --size;
+
+        if (path.depth > 0 && leaf->count < LEAF_MIN)
+        {
+            rebalance_leaf(path, leaf);
+        }
+        return true;
+    }
+
+    // First entry with key not less than given one
+    [[nodiscard]]
+    Iterator lower_bound(const KeyType &key) const noexcept
+    {
+        Leaf *leaf = find_leaf(key);
+        return make_iterator(leaf, Search::lower_bound(leaf->keys, USize(leaf->count), key));
+    }
+
+    // First entry with key greater than given one
+    [[nodiscard]]
+    Iterator upper_bound(const KeyType &key) const noexcept
+    {
+        Leaf *leaf = find_leaf(key);
+        return make_iterator(leaf, Search::upper_bound(leaf->keys, USize(leaf->count), key));
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        return size > 0 ? Iterator{ firstLeaf, 0 } : end();
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{};
+    }
+
+    // Iterator to the greatest entry, end() when tree is empty
+    [[nodiscard]]
+    Iterator last() const noexcept
+    {
+        return size > 0 ? Iterator{ lastLeaf, USize(lastLeaf->count - 1) } : end();
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Void clear() noexcept
+    {
+        release_node(root, height);
+        size = 0;
+        height = 0;
+        firstLeaf = allocate_leaf();
+        lastLeaf = firstLeaf;
+        root = firstLeaf;
+    }
+
+    Void copy(const BTreeMap &source) noexcept
+    {
+        assert(this != &source && "Copying into itself!");
+        if (root)
+        {
+            finalize();
+        }
+        if (!source.root)
+        {
+            return;
+        }
+
+        allocatorInfo = source.allocatorInfo;
+        size = source.size;
+        height = source.height;
+        Leaf *previous = nullptr;
+        root = clone_node(source.root, source.height, previous);
+        lastLeaf = previous;
+        lastLeaf->next = nullptr;
+    }
+
+    Void move(BTreeMap &source) noexcept
+    {
+        assert(this != &source && "Moving into itself!");
+        if (root)
+        {
+            finalize();
+        }
+
+        *this = source;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if (root)
+        {
+            release_node(root, height);
+        }
+
+        *this = {};
+    }
+
+private:
+    [[nodiscard]]
+    Leaf *allocate_leaf() noexcept
+    {
+        Leaf *leaf = Memory::start_object<Leaf, false>(allocatorInfo->allocate(allocatorInfo->allocator,
+                                                                               NODE_SIZE,
+                                                                               NODE_ALIGNMENT));
+        leaf->count = 0;
+        leaf->isLeaf = true;
+        leaf->previous = nullptr;
+        leaf->next = nullptr;
+        return leaf;
+    }
+
+    [[nodiscard]]
+    Inner *allocate_inner() noexcept
+    {
+        Inner *inner = Memory::start_object<Inner, false>(allocatorInfo->allocate(allocatorInfo->allocator,
+                                                                                  NODE_SIZE,
+                                                                                  NODE_ALIGNMENT));
+        inner->count = 0;
+        inner->isLeaf = false;
+        return inner;
+    }
+
+    Void deallocate_node(Node *node) noexcept
+    {
+        allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(node));
+    }
+
+    [[nodiscard]]
+    static Iterator make_iterator(Leaf *leaf, const USize index) noexcept
+    {
+        if (index < leaf->count)
+        {
+            return Iterator{ leaf, index };
+        }
+        return leaf->next ? Iterator{ leaf->next, 0 } : Iterator{};
+    }
+
+    [[nodiscard]]
+    static const KeyType &get_min_key(const Node *node) noexcept
+    {
+        while (!node->isLeaf)
+        {
+            node = static_cast<const Inner *>(node)->children[0];
+        }
+        return static_cast<const Leaf *>(node)->keys[0];
+    }
+
+    [[nodiscard]]
+    Leaf *find_leaf(const KeyType &key) const noexcept
+    {
+        assert(root && "Tree is not initialized!");
+        Node *node = root;
+        for (USize level = 0; level < height; ++level)
+        {
+            Inner *inner = static_cast<Inner *>(node);
+            node = inner->children[Search::upper_bound(inner->keys, USize(inner->count), key)];
+        }
+        return static_cast<Leaf *>(node);
+    }
+
+    [[nodiscard]]
+    Leaf *descend(const KeyType &key, Path &path) const noexcept
+    {
+        assert(root && "Tree is not initialized!");
+        Node *node = root;
+        path.depth = height;
+        for (USize level = 0; level < height; ++level)
+        {
+            Inner *inner = static_cast<Inner *>(node);
+            const USize index = Search::upper_bound(inner->keys, USize(inner->count), key);
+            path.nodes[level] = inner;
+            path.indices[level] = index;
+            node = inner->children[index];
+        }
+        return static_cast<Leaf *>(node);
+    }
+
+    // Writes copy of source into slot holding no live object
+    template <Manual Type>
+    static Void copy_into(Type &target, const Type &source) noexcept
+    {
+        if constexpr (Copyable<Type>)
+        {
+            target = Type();
+            target.copy(source);
+        } else {
+            target = source;
+        }
+    }
+
+    static Void finalize_key([[maybe_unused]] KeyType &key) noexcept
+    {
+        if constexpr (Finalizable<KeyType>)
+        {
+            key.finalize();
+        }
+    }
+
+    static Void replace_separator(KeyType &separator, const KeyType &key) noexcept
+    {
+        finalize_key(separator);
+        copy_into(separator, key);
+    }
+
+    // Shifts entries from index right by one, slot at index is left for caller to fill bytewise
+    static Void open_leaf_slot(Leaf *leaf, const USize index) noexcept
+    {
+        const USize tail = leaf->count - index;
+        std::memmove(static_cast<Void *>(leaf->keys + index + 1), leaf->keys + index, tail * sizeof(KeyType));
+        if constexpr (HAS_VALUES)
+        {
+            std::memmove(static_cast<Void *>(leaf->values + index + 1), leaf->values + index,
+                         tail * sizeof(ValueType));
+        }
+        ++leaf->count;
+    }
+
+    static Void insert_into_leaf(Leaf *leaf, const USize index, const KeyType &key) noexcept
+    {
+        open_leaf_slot(leaf, index);
+        copy_into(leaf->keys[index], key);
+        if constexpr (HAS_VALUES)
+        {
+            leaf->values[index] = ValueType();
+        }
+    }
+
+    static Void erase_from_leaf(Leaf *leaf, const USize index) noexcept
+    {
+        const USize tail = leaf->count - index - 1;
+        std::memmove(static_cast<Void *>(leaf->keys + index), leaf->keys + index + 1, tail * sizeof(KeyType));
+        if constexpr (HAS_VALUES)
+        {
+            std::memmove(static_cast<Void *>(leaf->values + index), leaf->values + index + 1,
+                         tail * sizeof(ValueType));
+        }
+        --leaf->count;
+    }
+
+    // Moves upper half of full leaf into new right sibling and inserts key into the proper half
+    Leaf *split_leaf(Leaf *leaf, const USize index, const KeyType &key) noexcept
+    {
+        Leaf *right = allocate_leaf();
+        const USize leftCount = (LEAF_CAPACITY + 1) / 2;
+        const USize moveFrom = index < leftCount ? leftCount - 1 : leftCount;
+        const USize moveCount = LEAF_CAPACITY - moveFrom;
+
+        std::memcpy(static_cast<Void *>(right->keys), leaf->keys + moveFrom, moveCount * sizeof(KeyType));
+        if constexpr (HAS_VALUES)
+        {
+            std::memcpy(static_cast<Void *>(right->values), leaf->values + moveFrom, moveCount * sizeof(ValueType));
+        }
+        right->count = UInt32(moveCount);
+        leaf->count = UInt32(moveFrom);
+
+        if (index < leftCount)
+        {
+            insert_into_leaf(leaf, index, key);
+        } else {
+            insert_into_leaf(right, index - moveFrom, key);
+        }
+
+        right->next = leaf->next;
+        right->previous = leaf;
+        if (leaf->next)
+        {
+            leaf->next->previous = right;
+        } else {
+            lastLeaf = right;
+        }
+        leaf->next = right;
+        return right;
+    }
+
+    // Links new right sibling of path's last node into parents, splitting them while they are full
+    Void insert_into_parent(Path &path, KeyType separator, Node *right) noexcept
+    {
+        Node *left = path.depth > 0 ? path.nodes[path.depth - 1]->children[path.indices[path.depth - 1]] : root;
+        while (path.depth > 0)
+        {
+            --path.depth;
+            Inner *parent = path.nodes[path.depth];
+            const USize index = path.indices[path.depth];
+            if (parent->count < INNER_CAPACITY)
+            {
+                insert_into_inner(parent, index, separator, right);
+                return;
+            }
+
+            // Full node plus one key is split around its middle key, which moves up
+            KeyType keys[INNER_CAPACITY + 1];
+            Node *children[INNER_CAPACITY + 2];
+            std::memcpy(static_cast<Void *>(keys), parent->keys, index * sizeof(KeyType));
+            keys[index] = separator;
+            std::memcpy(static_cast<Void *>(keys + index + 1), parent->keys + index,
+                        (INNER_CAPACITY - index) * sizeof(KeyType));
+            std::memcpy(children, parent->children, (index + 1) * sizeof(Node *));
+            children[index + 1] = right;
+            std::memcpy(children + index + 2, parent->children + index + 1,
+                        (INNER_CAPACITY - index) * sizeof(Node *));
+
+            const USize middle = (INNER_CAPACITY + 1) / 2;
+            Inner *sibling = allocate_inner();
+            std::memcpy(static_cast<Void *>(parent->keys), keys, middle * sizeof(KeyType));
+            std::memcpy(parent->children, children, (middle + 1) * sizeof(Node *));
+            parent->count = UInt32(middle);
+
+            const USize siblingCount = INNER_CAPACITY - middle;
+            std::memcpy(static_cast<Void *>(sibling->keys), keys + middle + 1, siblingCount * sizeof(KeyType));
+            std::memcpy(sibling->children, children + middle + 1, (siblingCount + 1) * sizeof(Node *));
+            sibling->count = UInt32(siblingCount);
+
+            separator = keys[middle];
+            left = parent;
+            right = sibling;
+        }
+
+        Inner *newRoot = allocate_inner();
+        newRoot->keys[0] = separator;
+        newRoot->children[0] = left;
+        newRoot->children[1] = right;
+        newRoot->count = 1;
+        root = newRoot;
+        ++height;
+    }
+
+    static Void insert_into_inner(Inner *inner, const USize index, const KeyType &key, Node *right) noexcept
+    {
+        const USize tail = inner->count - index;
+        std::memmove(static_cast<Void *>(inner->keys + index + 1), inner->keys + index, tail * sizeof(KeyType));
+        std::memmove(inner->children + index + 2, inner->children + index + 1, tail * sizeof(Node *));
+        inner->keys[index] = key;
+        inner->children[index + 1] = right;
+        ++inner->count;
+    }
+
+    // Removes key at index and child right of it
+    static Void erase_from_inner(Inner *inner, const USize index) noexcept
+    {
+        const USize tail = inner->count - index - 1;
+        std::memmove(static_cast<Void *>(inner->keys + index), inner->keys + index + 1, tail * sizeof(KeyType));
+        std::memmove(inner->children + index + 1, inner->children + index + 2, tail * sizeof(Node *));
+        --inner->count;
+    }
+
+    Void rebalance_leaf(Path &path, Leaf *leaf) noexcept
+    {
+        Inner *parent = path.nodes[path.depth - 1];
+        const USize index = path.indices[path.depth - 1];
+
+        if (index > 0)
+        {
+            Leaf *left = static_cast<Leaf *>(parent->children[index - 1]);
+            if (left->count > LEAF_MIN)
+            {
+                const USize last = left->count - 1;
+                open_leaf_slot(leaf, 0);
+                leaf->keys[0] = left->keys[last];
+                if constexpr (HAS_VALUES)
+                {
+                    leaf->values[0] = left->values[last];
+                }
+                --left->count;
+                replace_separator(parent->keys[index - 1], leaf->keys[0]);
+                return;
+            }
+        }
+
+        if (index < parent->count)
+        {
+            Leaf *right = static_cast<Leaf *>(parent->children[index + 1]);
+            if (right->count > LEAF_MIN)
+            {
+                leaf->keys[leaf->count] = right->keys[0];
+                if constexpr (HAS_VALUES)
+                {
+                    leaf->values[leaf->count] = right->values[0];
+                }
+                ++leaf->count;
+                erase_from_leaf(right, 0);
+                replace_separator(parent->keys[index], right->keys[0]);
+                return;
+            }
+        }
+
+        if (index > 0)
+        {
+            merge_leaves(static_cast<Leaf *>(parent->children[index - 1]), leaf);
+            finalize_key(parent->keys[index - 1]);
+            erase_from_inner(parent, index - 1);
+        } else {
+            merge_leaves(leaf, static_cast<Leaf *>(parent->children[index + 1]));
+            finalize_key(parent->keys[index]);
+            erase_from_inner(parent, index);
+        }
+
+        --path.depth;
+        rebalance_inner(path);
+    }
+
+    // Appends right leaf to left one and releases right
+    Void merge_leaves(Leaf *left, Leaf *right) noexcept
+    {
+        std::memcpy(static_cast<Void *>(left->keys + left->count), right->keys, right->count * sizeof(KeyType));
+        if constexpr (HAS_VALUES)
+        {
+            std::memcpy(static_cast<Void *>(left->values + left->count), right->values,
+                        right->count * sizeof(ValueType));
+        }
+        left->count += right->count;
+
+        left->next = right->next;
+        if (right->next)
+        {
+            right->next->previous = left;
+        } else {
+            lastLeaf = left;
+        }
+        deallocate_node(right);
+    }
+
+    // Fixes underflow of path's last inner node, continues upwards while merges happen
+    Void rebalance_inner(Path &path) noexcept
+    {
+        while (true)
+        {
+            Inner *node = path.nodes[path.depth];
+            if (path.depth == 0)
+            {
+                if (node->count == 0)
+                {
+                    root = node->children[0];
+                    deallocate_node(node);
+                    --height;
+                }
+                return;
+            }
+
+            if (node->count >= INNER_MIN)
+            {
+                return;
+            }
+
+            Inner *parent = path.nodes[path.depth - 1];
+            const USize index = path.indices[path.depth - 1];
+
+            if (index > 0)
+            {
+                Inner *left = static_cast<Inner *>(parent->children[index - 1]);
+                if (left->count > INNER_MIN)
+                {
+                    std::memmove(static_cast<Void *>(node->keys + 1), node->keys, node->count * sizeof(KeyType));
+                    std::memmove(node->children + 1, node->children, (node->count + 1) * sizeof(Node *));
+                    node->keys[0] = parent->keys[index - 1];
+                    node->children[0] = left->children[left->count];
+                    parent->keys[index - 1] = left->keys[left->count - 1];
+                    --left->count;
+                    ++node->count;
+                    return;
+                }
+            }
+
+            if (index < parent->count)
+            {
+                Inner *right = static_cast<Inner *>(parent->children[index + 1]);
+                if (right->count > INNER_MIN)
+                {
+                    node->keys[node->count] = parent->keys[index];
+                    node->children[node->count + 1] = right->children[0];
+                    ++node->count;
+                    parent->keys[index] = right->keys[0];
+                    std::memmove(static_cast<Void *>(right->keys), right->keys + 1,
+                                 (right->count - 1) * sizeof(KeyType));
+                    std::memmove(right->children, right->children + 1, right->count * sizeof(Node *));
+                    --right->count;
+                    return;
+                }
+            }
+
+            const USize separator = index > 0 ? index - 1 : index;
+            Inner *left = static_cast<Inner *>(parent->children[separator]);
+            Inner *right = static_cast<Inner *>(parent->children[separator + 1]);
+            left->keys[left->count] = parent->keys[separator];
+            std::memcpy(static_cast<Void *>(left->keys + left->count + 1), right->keys,
+                        right->count * sizeof(KeyType));
+            std::memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(Node *));
+            left->count += right->count + 1;
+            deallocate_node(right);
+            erase_from_inner(parent, separator);
+
+            --path.depth;
+        }
+    }
+
+    static Void finalize_entry([[maybe_unused]] Leaf *leaf, [[maybe_unused]] const USize index) noexcept
+    {
+        if constexpr (Finalizable<KeyType>)
+        {
+            leaf->keys[index].finalize();
+        }
+        if constexpr (HAS_VALUES && Finalizable<ValueType>)
+        {
+            leaf->values[index].finalize();
+        }
+    }
+
+    Void release_node(Node *node, const USize level) noexcept
+    {
+        if (level == 0)
+        {
+            Leaf *leaf = static_cast<Leaf *>(node);
+            for (USize i = 0; i < leaf->count; ++i)
+            {
+                finalize_entry(leaf, i);
+            }
+        } else {
+            Inner *inner = static_cast<Inner *>(node);
+            for (USize i = 0; i < inner->count; ++i)
+            {
+                finalize_key(inner->keys[i]);
+            }
+            for (USize i = 0; i <= inner->count; ++i)
+            {
+                release_node(inner->children[i], level - 1);
+            }
+        }
+        deallocate_node(node);
+    }
+
+    // Copies subtree and links cloned leaves in order, previous is the last cloned leaf so far
+    Node *clone_node(const Node *source, const USize level, Leaf *&previous) noexcept
+    {
+        if (level == 0)
+        {
+            const Leaf *sourceLeaf = static_cast<const Leaf *>(source);
+            Leaf *leaf = allocate_leaf();
+            leaf->count = sourceLeaf->count;
+            for (USize i = 0; i < sourceLeaf->count; ++i)
+            {
+                copy_into(leaf->keys[i], sourceLeaf->keys[i]);
+                if constexpr (HAS_VALUES)
+                {
+                    copy_into(leaf->values[i], sourceLeaf->values[i]);
+                }
+            }
+
+            leaf->previous = previous;
+            if (previous)
+            {
+                previous->next = leaf;
+            } else {
+                firstLeaf = leaf;
+            }
+            previous = leaf;
+            return leaf;
+        }
+
+        const Inner *sourceInner = static_cast<const Inner *>(source);
+        Inner *inner = allocate_inner();
+        inner->count = sourceInner->count;
+        for (USize i = 0; i < sourceInner->count; ++i)
+        {
+            copy_into(inner->keys[i], sourceInner->keys[i]);
+        }
+        for (USize i = 0; i <= sourceInner->count; ++i)
+        {
+            inner->children[i] = clone_node(sourceInner->children[i], level - 1, previous);
+        }
+        return inner;
+    }
+};
\ No newline at end of file
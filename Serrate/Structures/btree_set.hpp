@@ -0,0 +1,165 @@
+#pragma once
+#include "btree_map.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+// BTreeMap without values, leaves hold only keys so even more of them fit into one node
+template <Ordered KeyType, USize NodeBytes = 256>
+requires Manual<KeyType>
+class BTreeSet
+{
+private:
+    struct Empty {};
+    using Map = BTreeMap<KeyType, Empty, NodeBytes>;
+
+public:
+    struct Iterator
+    {
+    private:
+        typename Map::Iterator iterator;
+
+    public:
+        Iterator() noexcept
+        : iterator()
+        {}
+
+        Iterator(const typename Map::Iterator &initialIterator) noexcept
+        : iterator(initialIterator)
+        {}
+
+        const KeyType &operator*() const noexcept
+        {
+            return iterator.get_key();
+        }
+
+        const KeyType *operator->() const noexcept
+        {
+            return &iterator.get_key();
+        }
+
+        Void operator++() noexcept
+        {
+            ++iterator;
+        }
+
+        Void operator--() noexcept
+        {
+            --iterator;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return iterator == other.iterator;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return iterator != other.iterator;
+        }
+    };
+
+private:
+    Map map;
+
+public:
+    BTreeSet() noexcept
+    : map()
+    {}
+
+    [[nodiscard]]
+    static constexpr USize get_node_size() noexcept
+    {
+        return Map::get_node_size();
+    }
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        map.initialize(allocator);
+    }
+
+    // Builds set bottom up from strictly increasing keys
+    Void initialize(const KeyType *keys, const USize count,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        map.initialize(keys, nullptr, count, allocator);
+    }
+
+    // Returns false when key was already present
+    Bool insert(const KeyType &key) noexcept
+    {
+        return map.find_or_insert(key).isInserted;
+    }
+
+    Bool remove(const KeyType &key) noexcept
+    {
+        return map.remove(key);
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return map.contains(key);
+    }
+
+    [[nodiscard]]
+    Iterator lower_bound(const KeyType &key) const noexcept
+    {
+        return Iterator{ map.lower_bound(key) };
+    }
+
+    [[nodiscard]]
+    Iterator upper_bound(const KeyType &key) const noexcept
+    {
+        return Iterator{ map.upper_bound(key) };
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        return Iterator{ map.begin() };
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{ map.end() };
+    }
+
+    [[nodiscard]]
+    Iterator last() const noexcept
+    {
+        return Iterator{ map.last() };
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return map.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return map.is_empty();
+    }
+
+    Void clear() noexcept
+    {
+        map.clear();
+    }
+
+    Void copy(const BTreeSet &source) noexcept
+    {
+        map.copy(source.map);
+    }
+
+    Void move(BTreeSet &source) noexcept
+    {
+        map.move(source.map);
+    }
+
+    Void finalize() noexcept
+    {
+        map.finalize();
+    }
+};
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+#include "hash_map.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <shared_mutex>
+#include <mutex>
+#include <bit>
+
+// HashMap split into independently locked shards, readers of one shard do not block each other.
+// Each shard owns its nodes and buckets allocators, so non thread safe allocators can be used as
+// long as every shard gets its own one. Always initialize and finalize.
+template <Hashable KeyType, Manual ValueType, USize ShardCount = 16>
+requires (std::has_single_bit(ShardCount))
+class ConcurrentHashMap
+{
+private:
+    static constexpr USize SHARD_BITS = std::countr_zero(ShardCount);
+
+    struct alignas(Memory::CACHE_LINE_SIZE) Shard
+    {
+        mutable std::shared_mutex mutex;
+        HashMap<KeyType, ValueType> map;
+    };
+
+    Shard shards[ShardCount];
+
+public:
+    ConcurrentHashMap() noexcept = default;
+
+    Void initialize(AllocatorInfo *nodesAllocator = AllocatorInfo::get_default_allocator(),
+                    AllocatorInfo *bucketsAllocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(bucketsAllocator && nodesAllocator && "Allocator is nullptr!");
+        for (Shard &shard : shards)
+        {
+            // Buckets are allocated up front, lookups into HashMap without buckets are invalid
+            shard.map.initialize(USize(1), nodesAllocator, bucketsAllocator);
+        }
+    }
+
+    // Both arrays have to contain ShardCount allocators, shard i uses allocators at index i
+    Void initialize(AllocatorInfo *const *nodesAllocators, AllocatorInfo *const *bucketsAllocators) noexcept
+    {
+        assert(nodesAllocators && bucketsAllocators && "Invalid pointer!");
+        for (USize i = 0; i < ShardCount; ++i)
+        {
+            assert(nodesAllocators[i] && bucketsAllocators[i] && "Allocator is nullptr!");
+            shards[i].map.initialize(USize(1), nodesAllocators[i], bucketsAllocators[i]);
+        }
+    }
+
+    Void initialize(const USize initialCapacity,
+                    AllocatorInfo *nodesAllocator = AllocatorInfo::get_default_allocator(),
+                    AllocatorInfo *bucketsAllocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(bucketsAllocator && nodesAllocator && "Allocator is nullptr!");
+        assert(initialCapacity > 0 && "Initial capacity should be bigger than 0!");
+        const USize shardCapacity = std::max(initialCapacity / ShardCount, USize(1));
+        for (Shard &shard : shards)
+        {
+            shard.map.initialize(shardCapacity, nodesAllocator, bucketsAllocator);
+        }
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        const USize shardCapacity = std::max(newCapacity / ShardCount, USize(1));
+        for (Shard &shard : shards)
+        {
+            std::unique_lock lock(shard.mutex);
+            shard.map.reserve(shardCapacity);
+        }
+    }
+
+    Void push(const KeyType &key, const ValueType &value) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        Shard &shard = get_shard(hash);
+        std::unique_lock lock(shard.mutex);
+        shard.map.push(key, value, hash);
+    }
+
+    Void emplace(KeyType &key, ValueType &value) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        Shard &shard = get_shard(hash);
+        std::unique_lock lock(shard.mutex);
+        shard.map.emplace(key, value, hash);
+    }
+
+    // Copies found value into result, iterators cannot leave the shard lock
+    [[nodiscard]]
+    Bool find(const KeyType &key, ValueType &result) const noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        const Shard &shard = get_shard(hash);
+        std::shared_lock lock(shard.mutex);
+        return copy_found(shard.map.find(key, hash), shard.map.end(), result);
+    }
+
+    [[nodiscard]]
+    Bool find(const StringView &key, ValueType &result) const noexcept
+    requires std::is_same_v<KeyType, String>
+    {
+        const Shard &shard = get_shard(key.hash());
+        std::shared_lock lock(shard.mutex);
+        return copy_found(shard.map.find(key), shard.map.end(), result);
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        const Shard &shard = get_shard(hash_key(key));
+        std::shared_lock lock(shard.mutex);
+        return shard.map.contains(key);
+    }
+
+    [[nodiscard]]
+    Bool contains(const StringView &key) const noexcept
+    requires std::is_same_v<KeyType, String>
+    {
+        const Shard &shard = get_shard(key.hash());
+        std::shared_lock lock(shard.mutex);
+        return shard.map.find(key) != shard.map.end();
+    }
+
+    // Calls function(ValueType &) under exclusive shard lock, returns false when key does not exist
+    template <typename Function>
+    Bool visit(const KeyType &key, Function function) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        Shard &shard = get_shard(hash);
+        std::unique_lock lock(shard.mutex);
+        auto iterator = shard.map.find(key, hash);
+        if (iterator == shard.map.end())
+        {
+            return false;
+        }
+
+        function(*iterator);
+        return true;
+    }
+
+    USize remove(const KeyType &key) noexcept
+    {
+        Shard &shard = get_shard(hash_key(key));
+        std::unique_lock lock(shard.mutex);
+        return shard.map.remove(key);
+    }
+
+    USize remove(const StringView &key) noexcept
+    requires std::is_same_v<KeyType, String>
+    {
+        Shard &shard = get_shard(key.hash());
+        std::unique_lock lock(shard.mutex);
+        return shard.map.remove(key);
+    }
+
+    Void set_max_load_factor(const Float32 loadFactor) noexcept
+    {
+        for (Shard &shard : shards)
+        {
+            std::unique_lock lock(shard.mutex);
+            shard.map.set_max_load_factor(loadFactor);
+        }
+    }
+
+    // Sum of shard sizes, it is exact only when no other thread modifies map
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        USize size = 0;
+        for (const Shard &shard : shards)
+        {
+            std::shared_lock lock(shard.mutex);
+            size += shard.map.get_size();
+        }
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return get_size() == 0;
+    }
+
+    [[nodiscard]]
+    static constexpr USize get_shard_count() noexcept
+    {
+        return ShardCount;
+    }
+
+    Void clear() noexcept
+    {
+        for (Shard &shard : shards)
+        {
+            std::unique_lock lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+    // Not thread safe, no other thread can use map during finalize
+    Void finalize() noexcept
+    {
+        for (Shard &shard : shards)
+        {
+            shard.map.finalize();
+        }
+    }
+
+private:
+    // HashMap uses low bits of hash for buckets, so shard is chosen by high bits of mixed hash
+    [[nodiscard]]
+    static USize get_shard_index(const UInt64 hash) noexcept
+    {
+        if constexpr (ShardCount == 1)
+        {
+            return 0;
+        } else {
+            return USize((hash * 0x9E3779B97F4A7C15ULL) >> (64 - SHARD_BITS));
+        }
+    }
+
+    [[nodiscard]]
+    Shard &get_shard(const UInt64 hash) noexcept
+    {
+        return shards[get_shard_index(hash)];
+    }
+
+    [[nodiscard]]
+    const Shard &get_shard(const UInt64 hash) const noexcept
+    {
+        return shards[get_shard_index(hash)];
+    }
+
+    template <typename Iterator>
+    static Bool copy_found(const Iterator &found, const Iterator &end, ValueType &result) noexcept
+    {
+        if (found == end)
+        {
+            return false;
+        }
+
+        if constexpr (Copyable<ValueType>)
+        {
+            result.copy(*found);
+        } else {
+            result = *found;
+        }
+        return true;
+    }
+};
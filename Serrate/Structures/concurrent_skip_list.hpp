@@ -0,0 +1,393 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <new>
+
+// Ordered map which many threads can insert into and read from at the same time without locks. Every
+// node is linked with compare and swap, level 0 first, so once insert returns the key is visible to every
+// reader and iterators never see half linked node. Entries are never unlinked, towers are carved from
+// chunks by atomic bump and all of them are released at once by finalize, so readers can never touch
+// freed memory. Keys are unique, for repeating keys (like timestamps) add sequence number to key.
+// initialize, clear and finalize are not thread safe.
+template <Ordered KeyType, Manual ValueType, USize MaxHeight = 24>
+requires Manual<KeyType> && (MaxHeight > 1 && MaxHeight <= 32)
+class ConcurrentSkipList
+{
+private:
+    using Link = std::atomic<Void *>;
+
+    struct Node
+    {
+        KeyType   key;
+        ValueType value;
+        UInt32    height;
+    };
+
+    struct Chunk
+    {
+        Chunk              *next;
+        std::atomic<USize>  used;
+        USize               capacity;
+    };
+
+    static constexpr USize NODE_ALIGNMENT = std::max(alignof(Node), alignof(Link));
+    static constexpr USize LINKS_OFFSET   = Memory::align_offset(sizeof(Node), alignof(Link));
+    static constexpr USize CHUNK_HEADER   = Memory::align_offset(sizeof(Chunk), Memory::CACHE_LINE_SIZE);
+    static constexpr USize DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+public:
+    struct Iterator
+    {
+    private:
+        const Node *node;
+
+    public:
+        Iterator() noexcept
+        : node(nullptr)
+        {}
+
+        Iterator(const Node *initialNode) noexcept
+        : node(initialNode)
+        {}
+
+        [[nodiscard]]
+        const KeyType &get_key() const noexcept
+        {
+            return node->key;
+        }
+
+        [[nodiscard]]
+        const ValueType &get_value() const noexcept
+        {
+            return node->value;
+        }
+
+        Void operator++() noexcept
+        {
+            node = get_next(node, 0);
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return node == other.node;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return node != other.node;
+        }
+    };
+
+private:
+    AllocatorInfo      *allocatorInfo;
+    Node               *head;
+    std::atomic<Chunk*> chunks;
+    std::mutex          chunkMutex;
+    std::atomic<USize>  size;
+    USize               chunkSize;
+
+public:
+    ConcurrentSkipList() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , head(nullptr)
+    , chunks(nullptr)
+    , chunkMutex()
+    , size(0)
+    , chunkSize(DEFAULT_CHUNK_SIZE)
+    {}
+
+    // Chunk size is in bytes, every chunk holds many towers and is requested from allocator at once
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator(),
+                    const USize initialChunkSize = DEFAULT_CHUNK_SIZE) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        assert(initialChunkSize >= CHUNK_HEADER + get_node_size(MaxHeight) && "Chunk size is too small!");
+        allocatorInfo = allocator;
+        chunkSize = initialChunkSize;
+        chunks.store(nullptr, std::memory_order_relaxed);
+        size.store(0, std::memory_order_relaxed);
+        head = allocate_node(MaxHeight);
+    }
+
+    // Returns false when key already exists, existing value is left untouched
+    Bool insert(const KeyType &key, const ValueType &value) noexcept
+    {
+        Node *predecessors[MaxHeight];
+        Node *successors[MaxHeight];
+        find_neighbours(key, predecessors, successors);
+        if (successors[0] && !(key < successors[0]->key))
+        {
+            return false;
+        }
+
+        const UInt32 height = get_random_height();
+        Node *node = allocate_node(height);
+        if constexpr (Copyable<KeyType>)
+        {
+            node->key.copy(key);
+        } else {
+            node->key = key;
+        }
+        if constexpr (Copyable<ValueType>)
+        {
+            node->value.copy(value);
+        } else {
+            node->value = value;
+        }
+
+        // Level 0 decides if node is in the list, upper levels only speed up search
+        while (true)
+        {
+            for (UInt32 level = 0; level < height; ++level)
+            {
+                get_link(node, level).store(successors[level], std::memory_order_relaxed);
+            }
+
+            Void *expected = successors[0];
+            if (get_link(predecessors[0], 0).compare_exchange_strong(expected, node,
+                                                                    std::memory_order_release,
+                                                                    std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            find_neighbours(key, predecessors, successors);
+            if (successors[0] && !(key < successors[0]->key))
+            {
+                // Lost race to same key, tower stays unused in chunk until finalize
+                if constexpr (Finalizable<KeyType>)
+                {
+                    node->key.finalize();
+                }
+                if constexpr (Finalizable<ValueType>)
+                {
+                    node->value.finalize();
+                }
+                return false;
+            }
+        }
+
+        for (UInt32 level = 1; level < height; ++level)
+        {
+            while (true)
+            {
+                Void *expected = successors[level];
+                if (get_link(predecessors[level], level).compare_exchange_strong(expected, node,
+                                                                                std::memory_order_release,
+                                                                                std::memory_order_relaxed))
+                {
+                    break;
+                }
+
+                find_neighbours(key, predecessors, successors);
+                get_link(node, level).store(successors[level], std::memory_order_relaxed);
+            }
+        }
+
+        size.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Values are written only by insert, so returned pointer stays valid and readable until finalize
+    [[nodiscard]]
+    const ValueType *find(const KeyType &key) const noexcept
+    {
+        const Node *node = find_not_less(key);
+        return node && !(key < node->key) ? &node->value : nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    // First entry with key not less than given one, entries inserted later may show up during iteration
+    [[nodiscard]]
+    Iterator lower_bound(const KeyType &key) const noexcept
+    {
+        return Iterator{ find_not_less(key) };
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        return Iterator{ get_next(head, 0) };
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{};
+    }
+
+    // Exact only when no other thread inserts
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return get_next(head, 0) == nullptr;
+    }
+
+    Void clear() noexcept
+    {
+        AllocatorInfo *allocator = allocatorInfo;
+        const USize currentChunkSize = chunkSize;
+        release();
+        initialize(allocator, currentChunkSize);
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        release();
+        allocatorInfo = AllocatorInfo::get_default_allocator();
+        head = nullptr;
+        chunkSize = DEFAULT_CHUNK_SIZE;
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr USize get_node_size(const UInt32 height) noexcept
+    {
+        return Memory::align_offset(LINKS_OFFSET + height * sizeof(Link), NODE_ALIGNMENT);
+    }
+
+    [[nodiscard]]
+    static Link &get_link(const Node *node, const UInt32 level) noexcept
+    {
+        Byte *links = byte_cast(const_cast<Node *>(node)) + LINKS_OFFSET;
+        return reinterpret_cast<Link *>(links)[level];
+    }
+
+    [[nodiscard]]
+    static Node *get_next(const Node *node, const UInt32 level) noexcept
+    {
+        return static_cast<Node *>(get_link(node, level).load(std::memory_order_acquire));
+    }
+
+    // Geometric distribution with p = 1/4, state is per thread so inserting threads do not share it
+    [[nodiscard]]
+    static UInt32 get_random_height() noexcept
+    {
+        thread_local UInt64 state = UInt64(reinterpret_cast<USize>(&state)) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const UInt32 height = 1 + UInt32(std::countr_zero(state | (UInt64(1) << 62))) / 2;
+        return std::min(height, UInt32(MaxHeight));
+    }
+
+    Void find_neighbours(const KeyType &key, Node **predecessors, Node **successors) const noexcept
+    {
+        Node *node = head;
+        for (UInt32 level = MaxHeight; level-- > 0;)
+        {
+            Node *next = get_next(node, level);
+            while (next && next->key < key)
+            {
+                node = next;
+                next = get_next(node, level);
+            }
+            predecessors[level] = node;
+            successors[level] = next;
+        }
+    }
+
+    [[nodiscard]]
+    const Node *find_not_less(const KeyType &key) const noexcept
+    {
+        const Node *node = head;
+        const Node *next = nullptr;
+        for (UInt32 level = MaxHeight; level-- > 0;)
+        {
+            next = get_next(node, level);
+            while (next && next->key < key)
+            {
+                node = next;
+                next = get_next(node, level);
+            }
+        }
+        return next;
+    }
+
+    // Bump allocation from newest chunk, only thread which fills it takes the lock to add next one
+    Node *allocate_node(const UInt32 height) noexcept
+    {
+        const USize bytes = get_node_size(height);
+        while (true)
+        {
+            Chunk *chunk = chunks.load(std::memory_order_acquire);
+            if (chunk)
+            {
+                const USize offset = chunk->used.fetch_add(bytes, std::memory_order_relaxed);
+                if (offset + bytes <= chunk->capacity)
+                {
+                    Byte *memory = byte_cast(chunk) + CHUNK_HEADER + offset;
+                    Node *node = Memory::start_object<Node>(memory);
+                    node->height = height;
+                    for (UInt32 level = 0; level < height; ++level)
+                    {
+                        new (&get_link(node, level)) Link(nullptr);
+                    }
+                    return node;
+                }
+            }
+
+            std::lock_guard lock(chunkMutex);
+            if (chunks.load(std::memory_order_relaxed) == chunk)
+            {
+                Byte *memory = allocatorInfo->allocate(allocatorInfo->allocator, chunkSize, Memory::CACHE_LINE_SIZE);
+                assert(memory && "Failed to allocate chunk!");
+                Chunk *newChunk = new (memory) Chunk{};
+                newChunk->next = chunk;
+                newChunk->used.store(0, std::memory_order_relaxed);
+                newChunk->capacity = chunkSize - CHUNK_HEADER;
+                chunks.store(newChunk, std::memory_order_release);
+            }
+        }
+    }
+
+    Void release() noexcept
+    {
+        if constexpr (Finalizable<KeyType> || Finalizable<ValueType>)
+        {
+            if (head)
+            {
+                for (Node *node = get_next(head, 0); node; node = get_next(node, 0))
+                {
+                    if constexpr (Finalizable<KeyType>)
+                    {
+                        node->key.finalize();
+                    }
+                    if constexpr (Finalizable<ValueType>)
+                    {
+                        node->value.finalize();
+                    }
+                }
+            }
+        }
+
+        Chunk *chunk = chunks.load(std::memory_order_acquire);
+        while (chunk)
+        {
+            Chunk *next = chunk->next;
+            chunk->~Chunk();
+            allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(chunk));
+            chunk = next;
+        }
+        chunks.store(nullptr, std::memory_order_relaxed);
+        size.store(0, std::memory_order_relaxed);
+        head = nullptr;
+    }
+};
\ No newline at end of file
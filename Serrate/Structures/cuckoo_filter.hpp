@@ -0,0 +1,351 @@
+#pragma once
+#include "hash_map.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/cryptography.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// Cuckoo filter with 16 bit fingerprints, four of them packed into one 64 bit bucket word, so bucket is
+// searched with few word operations. Unlike Bloom filter it supports remove of inserted keys.
+// Every key has two candidate buckets, second one is first one xored with fingerprint hash, so it can be
+// computed from either bucket when fingerprint is kicked out during insert.
+template <Hashable KeyType>
+class CuckooFilter
+{
+private:
+    static constexpr UInt64 MAGIC             = 0x4B43554353524553; // "SERSCUCK"
+    static constexpr USize  SLOTS_PER_BUCKET  = 4;
+    static constexpr USize  MAX_KICKS         = 500;
+    static constexpr USize  BATCH_SIZE        = 16;
+    static constexpr UInt64 LOW_BITS          = 0x0001000100010001;
+    static constexpr UInt64 HIGH_BITS         = 0x8000800080008000;
+    static constexpr UInt16 EMPTY_FINGERPRINT = 0;
+
+    struct Header
+    {
+        UInt64 magic;
+        UInt64 bucketCount;
+        UInt64 size;
+        UInt64 victim;
+    };
+
+    AllocatorInfo *allocatorInfo;
+    UInt64        *buckets;
+    USize          bucketCount;
+    USize          size;
+    UInt64         randomState;
+    USize          victimIndex;
+    UInt16         victimFingerprint; // Fingerprint left homeless by failed insert, still answered by lookups
+
+public:
+    CuckooFilter() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , buckets(nullptr)
+    , bucketCount(0)
+    , size(0)
+    , randomState(0)
+    , victimIndex(0)
+    , victimFingerprint(EMPTY_FINGERPRINT)
+    {}
+
+    // Sizes table so expectedCount keys take at most 95% of slots
+    Void initialize(const USize expectedCount,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        const USize minBuckets = (expectedCount * 100 / 95 + SLOTS_PER_BUCKET - 1) / SLOTS_PER_BUCKET;
+        initialize_buckets(Memory::align_binary(std::max(minBuckets, USize(2))), allocator);
+    }
+
+    // Returns false when table is too full, filter still answers for this key but the next insert will fail too
+    Bool insert(const KeyType &key) noexcept
+    {
+        if (victimFingerprint != EMPTY_FINGERPRINT)
+        {
+            return false;
+        }
+
+        const UInt64 hash = mix(key);
+        UInt16 fingerprint = get_fingerprint(hash);
+        USize index = USize(hash) & (bucketCount - 1);
+        ++size;
+        if (try_store(index, fingerprint) || try_store(get_alternate(index, fingerprint), fingerprint))
+        {
+            return true;
+        }
+
+        if (next_random() & 1)
+        {
+            index = get_alternate(index, fingerprint);
+        }
+
+        for (USize kick = 0; kick < MAX_KICKS; ++kick)
+        {
+            const USize shift = (next_random() % SLOTS_PER_BUCKET) * 16;
+            const UInt16 kicked = UInt16(buckets[index] >> shift);
+            buckets[index] = (buckets[index] & ~(UInt64(0xFFFF) << shift)) | (UInt64(fingerprint) << shift);
+
+            fingerprint = kicked;
+            index = get_alternate(index, fingerprint);
+            if (try_store(index, fingerprint))
+            {
+                return true;
+            }
+        }
+
+        victimIndex = index;
+        victimFingerprint = fingerprint;
+        return false;
+    }
+
+    // False means key is not in filter, true means it probably is
+    [[nodiscard]]
+    Bool may_contain(const KeyType &key) const noexcept
+    {
+        const UInt64 hash = mix(key);
+        const UInt16 fingerprint = get_fingerprint(hash);
+        const USize first = USize(hash) & (bucketCount - 1);
+        return contains_fingerprint(first, get_alternate(first, fingerprint), fingerprint);
+    }
+
+    // Hashes and prefetches both buckets of a whole group before testing any of them
+    Void may_contain_batch(const KeyType *keys, const USize count, Bool *results) const noexcept
+    {
+        assert(((keys && results) || count == 0) && "Invalid pointer!");
+        USize firsts[BATCH_SIZE];
+        USize seconds[BATCH_SIZE];
+        UInt16 fingerprints[BATCH_SIZE];
+        for (USize offset = 0; offset < count; offset += BATCH_SIZE)
+        {
+            const USize groupCount = std::min(count - offset, BATCH_SIZE);
+            for (USize i = 0; i < groupCount; ++i)
+            {
+                const UInt64 hash = mix(keys[offset + i]);
+                fingerprints[i] = get_fingerprint(hash);
+                firsts[i] = USize(hash) & (bucketCount - 1);
+                seconds[i] = get_alternate(firsts[i], fingerprints[i]);
+                Memory::prefetch(buckets + firsts[i]);
+                Memory::prefetch(buckets + seconds[i]);
+            }
+
+            for (USize i = 0; i < groupCount; ++i)
+            {
+                results[offset + i] = contains_fingerprint(firsts[i], seconds[i], fingerprints[i]);
+            }
+        }
+    }
+
+    // Key has to be inserted before, removing never inserted key may remove another key with equal fingerprint
+    Bool remove(const KeyType &key) noexcept
+    {
+        const UInt64 hash = mix(key);
+        const UInt16 fingerprint = get_fingerprint(hash);
+        const USize first = USize(hash) & (bucketCount - 1);
+        const USize second = get_alternate(first, fingerprint);
+
+        if (try_erase(first, fingerprint) || try_erase(second, fingerprint))
+        {
+            --size;
+            // Slot was freed, homeless fingerprint can be placed again
+            if (victimFingerprint != EMPTY_FINGERPRINT)
+            {
+                const UInt16 victim = victimFingerprint;
+                victimFingerprint = EMPTY_FINGERPRINT;
+                --size;
+                insert_fingerprint(victimIndex, victim);
+            }
+            return true;
+        }
+
+        if (victimFingerprint == fingerprint && (victimIndex == first || victimIndex == second))
+        {
+            victimFingerprint = EMPTY_FINGERPRINT;
+            --size;
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return bucketCount * SLOTS_PER_BUCKET;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Void clear() noexcept
+    {
+        std::memset(buckets, 0, bucketCount * sizeof(UInt64));
+        size = 0;
+        victimIndex = 0;
+        victimFingerprint = EMPTY_FINGERPRINT;
+    }
+
+    [[nodiscard]]
+    USize get_serialized_size() const noexcept
+    {
+        return sizeof(Header) + bucketCount * sizeof(UInt64);
+    }
+
+    // Destination has to hold get_serialized_size() bytes
+    Void serialize(Byte *destination) const noexcept
+    {
+        assert(destination && "Invalid pointer!");
+        const Header header = {
+            .magic       = MAGIC,
+            .bucketCount = bucketCount,
+            .size        = size,
+            .victim      = (UInt64(victimIndex) << 16) | victimFingerprint
+        };
+        std::memcpy(destination, &header, sizeof(Header));
+        std::memcpy(destination + sizeof(Header), buckets, bucketCount * sizeof(UInt64));
+    }
+
+    // Initializes filter from bytes written by serialize, returns false when bytes are not a valid filter.
+    // Storage of already initialized filter is released first, failed call leaves filter untouched
+    [[nodiscard]]
+    Bool deserialize(const Byte *source, const USize bytes,
+                     AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(source && "Invalid pointer!");
+        if (bytes < sizeof(Header))
+        {
+            return false;
+        }
+
+        Header header;
+        std::memcpy(&header, source, sizeof(Header));
+        if (header.magic != MAGIC || header.bucketCount < 2 || !std::has_single_bit(header.bucketCount)
+            || (bytes - sizeof(Header)) % sizeof(UInt64) != 0
+            || (bytes - sizeof(Header)) / sizeof(UInt64) != header.bucketCount
+            || (header.victim >> 16) >= header.bucketCount)
+        {
+            return false;
+        }
+
+        finalize();
+        initialize_buckets(USize(header.bucketCount), allocator);
+        std::memcpy(buckets, source + sizeof(Header), bucketCount * sizeof(UInt64));
+        size = USize(header.size);
+        victimIndex = USize(header.victim >> 16);
+        victimFingerprint = UInt16(header.victim);
+        return true;
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if (buckets)
+        {
+            Memory::deallocate(allocatorInfo, buckets);
+        }
+
+        *this = {};
+    }
+
+private:
+    Void initialize_buckets(const USize newBucketCount, AllocatorInfo *allocator) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        bucketCount = newBucketCount;
+        randomState = 0x9E3779B97F4A7C15;
+        buckets = Memory::allocate<UInt64>(allocatorInfo, bucketCount);
+        clear();
+    }
+
+    // hash_key is identity for integers, so it is always finished with XXH3
+    [[nodiscard]]
+    static UInt64 mix(const KeyType &key) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        return Cryptography::hash(&hash, 1);
+    }
+
+    [[nodiscard]]
+    static UInt16 get_fingerprint(const UInt64 hash) noexcept
+    {
+        const UInt16 fingerprint = UInt16(hash >> 48);
+        return fingerprint == EMPTY_FINGERPRINT ? UInt16(1) : fingerprint;
+    }
+
+    [[nodiscard]]
+    USize get_alternate(const USize index, const UInt16 fingerprint) const noexcept
+    {
+        return (index ^ USize(UInt64(fingerprint) * 0x5BD1E995)) & (bucketCount - 1);
+    }
+
+    // Sets high bit of every 16 bit lane that equals fingerprint
+    [[nodiscard]]
+    static UInt64 match_lanes(const UInt64 bucket, const UInt16 fingerprint) noexcept
+    {
+        const UInt64 difference = bucket ^ (LOW_BITS * fingerprint);
+        return (difference - LOW_BITS) & ~difference & HIGH_BITS;
+    }
+
+    [[nodiscard]]
+    Bool contains_fingerprint(const USize first, const USize second, const UInt16 fingerprint) const noexcept
+    {
+        if (match_lanes(buckets[first], fingerprint) | match_lanes(buckets[second], fingerprint))
+        {
+            return true;
+        }
+        return victimFingerprint == fingerprint && (victimIndex == first || victimIndex == second);
+    }
+
+    Bool try_store(const USize index, const UInt16 fingerprint) noexcept
+    {
+        const UInt64 emptyLanes = match_lanes(buckets[index], EMPTY_FINGERPRINT);
+        if (emptyLanes == 0)
+        {
+            return false;
+        }
+
+        const USize shift = USize(std::countr_zero(emptyLanes)) - 15;
+        buckets[index] |= UInt64(fingerprint) << shift;
+        return true;
+    }
+
+    Bool try_erase(const USize index, const UInt16 fingerprint) noexcept
+    {
+        const UInt64 lanes = match_lanes(buckets[index], fingerprint);
+        if (lanes == 0)
+        {
+            return false;
+        }
+
+        const USize shift = USize(std::countr_zero(lanes)) - 15;
+        buckets[index] &= ~(UInt64(0xFFFF) << shift);
+        return true;
+    }
+
+    Void insert_fingerprint(const USize index, const UInt16 fingerprint) noexcept
+    {
+        ++size;
+        if (!try_store(index, fingerprint) && !try_store(get_alternate(index, fingerprint), fingerprint))
+        {
+            victimIndex = index;
+            victimFingerprint = fingerprint;
+        }
+    }
+
+    UInt64 next_random() noexcept
+    {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        return randomState;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,401 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+// Ring buffer with power of two capacity, index is masked instead of wrapped by modulo. Push and remove at
+// both ends are O(1), growth doubles capacity and unrolls elements to start of new block. Elements live
+// in at most two contiguous segments, get_segments gives them for plain loops or bulk copies.
+template <Manual Type>
+class Deque
+{
+public:
+    // First segment starts at front, second continues at start of block after wrap
+    struct Segments
+    {
+        Type *first;
+        USize firstSize;
+        Type *second;
+        USize secondSize;
+    };
+
+    struct ConstSegments
+    {
+        const Type *first;
+        USize       firstSize;
+        const Type *second;
+        USize       secondSize;
+    };
+
+    struct Iterator
+    {
+    private:
+        Deque *deque;
+        USize  index;
+
+    public:
+        Iterator() noexcept
+        : deque(nullptr)
+        , index(0)
+        {}
+
+        Iterator(Deque *initialDeque, const USize initialIndex) noexcept
+        : deque(initialDeque)
+        , index(initialIndex)
+        {}
+
+        Type &operator*() const noexcept
+        {
+            return (*deque)[index];
+        }
+
+        Type *operator->() const noexcept
+        {
+            return &(*deque)[index];
+        }
+
+        Void operator++() noexcept
+        {
+            ++index;
+        }
+
+        Void operator--() noexcept
+        {
+            --index;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return index == other.index;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return index != other.index;
+        }
+    };
+
+private:
+    AllocatorInfo *allocatorInfo;
+    Type          *elements;
+    USize          capacity, head, size;
+
+public:
+    Deque() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , elements(nullptr)
+    , capacity(0)
+    , head(0)
+    , size(0)
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        *this = {};
+        allocatorInfo = allocator;
+    }
+
+    // Capacity is rounded up to power of two
+    Void initialize(const USize initialCapacity, AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        initialize(allocator);
+        reserve(initialCapacity);
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        if (newCapacity <= capacity)
+        {
+            return;
+        }
+
+        const USize roundedCapacity = std::bit_ceil(std::max(newCapacity, Memory::MIN_GROWTH));
+        Type *newElements = Memory::allocate<Type>(allocatorInfo, roundedCapacity);
+        if (elements)
+        {
+            const USize firstSize = std::min(size, capacity - head);
+            relocate(newElements, elements + head, firstSize);
+            relocate(newElements + firstSize, elements, size - firstSize);
+            Memory::deallocate(allocatorInfo, elements);
+        }
+
+        elements = newElements;
+        capacity = roundedCapacity;
+        head = 0;
+    }
+
+    Type &push_back(const Type &element) noexcept
+    {
+        Type &target = get_back_slot();
+        if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+        return target;
+    }
+
+    Type &push_front(const Type &element) noexcept
+    {
+        Type &target = get_front_slot();
+        if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+        return target;
+    }
+
+    Type &emplace_back(Type &element) noexcept
+    {
+        Type &target = get_back_slot();
+        take(target, element);
+        return target;
+    }
+
+    Type &emplace_front(Type &element) noexcept
+    {
+        Type &target = get_front_slot();
+        take(target, element);
+        return target;
+    }
+
+    Void remove_back() noexcept
+    {
+        assert(size > 0 && "Deque is empty!");
+        --size;
+        if constexpr (Finalizable<Type>)
+        {
+            elements[(head + size) & (capacity - 1)].finalize();
+        }
+    }
+
+    Void remove_front() noexcept
+    {
+        assert(size > 0 && "Deque is empty!");
+        if constexpr (Finalizable<Type>)
+        {
+            elements[head].finalize();
+        }
+        head = (head + 1) & (capacity - 1);
+        --size;
+    }
+
+    [[nodiscard("Use remove_back")]]
+    Type pop_back() noexcept
+    {
+        assert(size > 0 && "Deque is empty!");
+        --size;
+        Type element{};
+        take(element, elements[(head + size) & (capacity - 1)]);
+        return element;
+    }
+
+    [[nodiscard("Use remove_front")]]
+    Type pop_front() noexcept
+    {
+        assert(size > 0 && "Deque is empty!");
+        Type element{};
+        take(element, elements[head]);
+        head = (head + 1) & (capacity - 1);
+        --size;
+        return element;
+    }
+
+    // Index 0 is front
+    Type &operator[](const USize index) noexcept
+    {
+        assert(index < size);
+        return elements[(head + index) & (capacity - 1)];
+    }
+
+    [[nodiscard]]
+    const Type &operator[](const USize index) const noexcept
+    {
+        assert(index < size);
+        return elements[(head + index) & (capacity - 1)];
+    }
+
+    Type &get_first() noexcept
+    {
+        assert(size > 0);
+        return elements[head];
+    }
+
+    [[nodiscard]]
+    const Type &get_first() const noexcept
+    {
+        assert(size > 0);
+        return elements[head];
+    }
+
+    Type &get_last() noexcept
+    {
+        assert(size > 0);
+        return (*this)[size - 1];
+    }
+
+    [[nodiscard]]
+    const Type &get_last() const noexcept
+    {
+        assert(size > 0);
+        return (*this)[size - 1];
+    }
+
+    [[nodiscard]]
+    Segments get_segments() noexcept
+    {
+        const USize firstSize = std::min(size, capacity - head);
+        return Segments{ elements + head, firstSize, elements, size - firstSize };
+    }
+
+    [[nodiscard]]
+    ConstSegments get_segments() const noexcept
+    {
+        const USize firstSize = std::min(size, capacity - head);
+        return ConstSegments{ elements + head, firstSize, elements, size - firstSize };
+    }
+
+    [[nodiscard]]
+    Iterator begin() noexcept
+    {
+        return Iterator{ this, 0 };
+    }
+
+    [[nodiscard]]
+    Iterator end() noexcept
+    {
+        return Iterator{ this, size };
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Void clear() noexcept
+    {
+        if constexpr (Finalizable<Type>)
+        {
+            for (USize i = 0; i < size; ++i)
+            {
+                elements[(head + i) & (capacity - 1)].finalize();
+            }
+        }
+        head = 0;
+        size = 0;
+    }
+
+    Void copy(const Deque &source) noexcept
+    {
+        assert(&source != this && "Tried to copy deque into itself!");
+        finalize();
+        allocatorInfo = source.allocatorInfo;
+        reserve(source.size);
+        for (USize i = 0; i < source.size; ++i)
+        {
+            push_back(source[i]);
+        }
+    }
+
+    Void move(Deque &source) noexcept
+    {
+        assert(&source != this && "Tried to move deque into itself!");
+        finalize();
+        allocatorInfo = source.allocatorInfo;
+        elements = source.elements;
+        capacity = source.capacity;
+        head = source.head;
+        size = source.size;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        clear();
+        if (elements)
+        {
+            Memory::deallocate(allocatorInfo, elements);
+        }
+        *this = {};
+    }
+
+private:
+    Type &get_back_slot() noexcept
+    {
+        if (size == capacity)
+        {
+            reserve(Memory::grow_capacity(capacity, size + 1, EGrowthPolicy::Double));
+        }
+        Type &target = elements[(head + size) & (capacity - 1)];
+        ++size;
+        return target;
+    }
+
+    Type &get_front_slot() noexcept
+    {
+        if (size == capacity)
+        {
+            reserve(Memory::grow_capacity(capacity, size + 1, EGrowthPolicy::Double));
+        }
+        head = (head - 1) & (capacity - 1);
+        ++size;
+        return elements[head];
+    }
+
+    // Source is left empty, so slot can be reused without finalize
+    static Void take(Type &target, Type &source) noexcept
+    {
+        if constexpr (Moveable<Type>)
+        {
+            target.move(source);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(source);
+            if constexpr (Finalizable<Type>)
+            {
+                source.finalize();
+            }
+        } else {
+            target = source;
+        }
+    }
+
+    // Moves count elements to default constructed target
+    static Void relocate(Type *target, Type *source, const USize count) noexcept
+    {
+        if constexpr (Relocatable<Type>)
+        {
+            if (count > 0)
+            {
+                std::memcpy(static_cast<Void *>(target), source, count * sizeof(Type));
+            }
+        } else {
+            for (USize i = 0; i < count; ++i)
+            {
+                take(target[i], source[i]);
+            }
+        }
+    }
+};
\ No newline at end of file
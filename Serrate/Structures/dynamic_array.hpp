@@ -1,5 +1,6 @@
 #pragma once
 #include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/simd.hpp"
 #include "Serrate/Memory/memory_utils.hpp"
 
 #include <spdlog/spdlog.h>
@@ -9,10 +10,11 @@ template <Manual Type>
 class DynamicArray
 {
 private:
-    static constexpr USize EXPANSION_SIZE = 32;
     AllocatorInfo *allocatorInfo;
     Type *elements;
     USize capacity, size;
+    EGrowthPolicy growthPolicy;
+    USize reallocationCount; // Growths caused by append or insert, reserve up front when it keeps rising
 
 public:
     DynamicArray() noexcept
@@ -20,6 +22,8 @@ public:
     , elements(nullptr)
     , capacity(0)
     , size(0)
+    , growthPolicy(EGrowthPolicy::Geometric)
+    , reallocationCount(0)
     {}
 
     Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
@@ -90,60 +94,16 @@ public:
             return;
         }
 
-        Type *newElements = Memory::allocate<Type>(allocatorInfo, newCapacity);
-        if constexpr (Moveable<Type>)
+        if constexpr (Relocatable<Type>)
         {
-            Type *data = newElements;
-            Type *sourceData = elements;
-            const Type *sourceDataEnd = elements + size;
-            for (; sourceData < sourceDataEnd; ++data, ++sourceData)
-            {
-                data->move(*sourceData);
-            }
-        }
-        else if constexpr (Copyable<Type>)
-        {
-            Type *data = newElements;
-            const Type *sourceData = elements;
-            const Type *sourceDataEnd = elements + size;
-            for (; sourceData < sourceDataEnd; ++data, ++sourceData)
-            {
-                data->copy(*sourceData);
-            }
+            elements = Memory::reallocate(allocatorInfo, elements, capacity, newCapacity);
+            capacity = newCapacity;
         } else {
-            memcpy(newElements, elements, size * sizeof(Type));
-        }
-
-        if (elements)
-        {
-            if constexpr (Finalizable<Type>)
-            {
-                const Type *dataEnd = elements + size;
-                for (Type *data = elements; data < dataEnd; ++data)
-                {
-                    data->finalize();
-                }
-            }
-            Memory::deallocate(allocatorInfo, elements);
-        }
-        elements = newElements;
-        capacity = newCapacity;
-    }
-
-    Void resize(const USize newSize, const Type &initialElement = {}) noexcept
-    {
-        if (newSize == size)
-        {
-            return;
-        }
-
-        if (newSize > capacity)
-        {
-            Type *newElements = Memory::allocate<Type>(allocatorInfo, newSize);
+            Type *newElements = Memory::allocate<Type>(allocatorInfo, newCapacity);
             if constexpr (Moveable<Type>)
             {
                 Type *data = newElements;
-                const Type *sourceData = elements;
+                Type *sourceData = elements;
                 const Type *sourceDataEnd = elements + size;
                 for (; sourceData < sourceDataEnd; ++data, ++sourceData)
                 {
@@ -159,7 +119,9 @@ public:
                 {
                     data->copy(*sourceData);
                 }
-            } else {
+            }
+            else if (elements)
+            {
                 memcpy(newElements, elements, size * sizeof(Type));
             }
 
@@ -175,9 +137,23 @@ public:
                 }
                 Memory::deallocate(allocatorInfo, elements);
             }
+            elements = newElements;
+            capacity = newCapacity;
+        }
+    }
+
+    Void resize(const USize newSize, const Type &initialElement = {}) noexcept
+    {
+        if (newSize == size)
+        {
+            return;
+        }
+
+        if (newSize > capacity)
+        {
+            reserve(newSize);
             const USize oldSize = size;
             size = newSize;
-            capacity = newSize;
             fill(oldSize, size, initialElement);
         }
         else if (newSize > size)
@@ -186,6 +162,14 @@ public:
             size = newSize;
             fill(oldSize, size, initialElement);
         } else { // newSize < size
+            if constexpr (Finalizable<Type>)
+            {
+                const Type *dataEnd = elements + size;
+                for (Type *data = elements + newSize; data < dataEnd; ++data)
+                {
+                    data->finalize();
+                }
+            }
             size = newSize;
         }
     }
@@ -195,8 +179,7 @@ public:
     {
         if (capacity == size)
         {
-            SPDLOG_WARN("Reallocation during append, try reserve more memory: {}", capacity + EXPANSION_SIZE);
-            reserve(capacity + EXPANSION_SIZE);
+            grow();
         }
 
         Type &target = elements[size];
@@ -214,33 +197,13 @@ public:
 
     Type &push(const Type &element, const USize index) noexcept
     {
-        assert(index > size && "Element cannot be push after back!");
+        assert(index <= size && "Element cannot be push after back!");
         if (capacity == size)
         {
-            SPDLOG_WARN("Reallocation during append, try reserve more memory: {}", capacity + EXPANSION_SIZE);
-            reserve(capacity + EXPANSION_SIZE);
+            grow();
         }
 
-        Type* currentElement = &elements[size];
-        Type* previousElement = (currentElement - 1);
-        for (USize i = size; i > index; --i, --currentElement, --previousElement)
-        {
-            if constexpr (Moveable<Type>)
-            {
-                currentElement->move(*previousElement);
-            }
-            else if constexpr (Copyable<Type>)
-            {
-                currentElement->copy(*previousElement);
-
-                if constexpr (Finalizable<Type>) // This is not necessary, but if someone doesn't want to have move, this should help avoid leaks
-                {
-                    previousElement->finalize();
-                }
-            } else {
-                *currentElement = *previousElement;
-            }
-        }
+        shift_right(index);
 
         Type& target = elements[index];
         if constexpr (Copyable<Type>)
@@ -265,8 +228,7 @@ public:
     {
         if (capacity == size)
         {
-            SPDLOG_WARN("Reallocation during emplace, try reserve more memory: {}", capacity + EXPANSION_SIZE);
-            reserve(capacity + EXPANSION_SIZE);
+            grow();
         }
 
         Type &target = elements[size];
@@ -276,7 +238,7 @@ public:
         {
             target.move(element);
         }
-        else if (Copyable<Type>)
+        else if constexpr (Copyable<Type>)
         {
             target.copy(element);
         } else {
@@ -288,33 +250,13 @@ public:
 
     Type &emplace(Type& element, const USize index) noexcept
     {
-        assert(index > size && "Element cannot be push after back!");
+        assert(index <= size && "Element cannot be push after back!");
         if (capacity == size)
         {
-            SPDLOG_WARN("Reallocation during append, try reserve more memory: {}", capacity + EXPANSION_SIZE);
-            reserve(capacity + EXPANSION_SIZE);
+            grow();
         }
 
-        Type* currentElement = &elements[size];
-        Type* previousElement = (currentElement - 1);
-        for (USize i = size; i > index; --i, --currentElement, --previousElement)
-        {
-            if constexpr (Moveable<Type>)
-            {
-                currentElement->move(*previousElement);
-            }
-            else if constexpr (Copyable<Type>)
-            {
-                currentElement->copy(*previousElement);
-
-                if constexpr (Finalizable<Type>) // This is not necessary, but if someone doesn't want to have move, this should help avoid leaks
-                {
-                    previousElement->finalize();
-                }
-            } else {
-                *currentElement = *previousElement;
-            }
-        }
+        shift_right(index);
 
 
         Type& target = elements[index];
@@ -345,7 +287,7 @@ public:
     {
         if constexpr (Finalizable<Type>)
         {
-            elements[size].finalize();
+            elements[size - 1].finalize();
         }
         --size;
     }
@@ -357,26 +299,7 @@ public:
             elements[index].finalize();
         }
 
-        Type* currentElement = &elements[index];
-        Type* nextElement = (currentElement + 1);
-        for (USize i = index; i < size; ++i, ++currentElement, ++nextElement)
-        {
-            if constexpr (Moveable<Type>)
-            {
-                currentElement->move(*nextElement);
-            }
-            else if constexpr (Copyable<Type>)
-            {
-                currentElement->copy(*nextElement);
-
-                if constexpr (Finalizable<Type>) // This is not necessary, but if someone doesn't want to have move, this should help avoid leaks
-                {
-                    nextElement->finalize();
-                }
-            } else {
-                *currentElement = *nextElement;
-            }
-        }
+        shift_left(index);
 
         --size;
     }
@@ -389,6 +312,12 @@ public:
     // Remove element and swap with last element
     Void remove_swap(USize index)
     {
+        if (index == size - 1)
+        {
+            remove_back();
+            return;
+        }
+
         if constexpr (Finalizable<Type>)
         {
             elements[index].finalize();
@@ -396,18 +325,18 @@ public:
 
         if constexpr (Moveable<Type>)
         {
-            elements[index].move(elements[size]);
+            elements[index].move(elements[size - 1]);
         }
         else if constexpr (Copyable<Type>)
         {
-            elements[index].copy(elements[size]);
+            elements[index].copy(elements[size - 1]);
 
             if constexpr (Finalizable<Type>)
             {
-                elements[size].finalize();
+                elements[size - 1].finalize();
             }
         } else {
-            elements[index] = elements[size];
+            elements[index] = elements[size - 1];
         }
 
         --size;
@@ -421,18 +350,18 @@ public:
 
         if constexpr (Moveable<Type>)
         {
-            element.move(elements[size]);
+            element.move(elements[size - 1]);
         }
         else if constexpr (Copyable<Type>)
         {
-            element.copy(elements[size]);
+            element.copy(elements[size - 1]);
 
             if constexpr (Finalizable<Type>)
             {
-                elements[size].finalize();
+                elements[size - 1].finalize();
             }
         } else {
-            element = elements[size];
+            element = elements[size - 1];
         }
         --size;
 
@@ -460,26 +389,7 @@ public:
             element = elements[index];
         }
 
-        Type* currentElement = &elements[index];
-        Type* nextElement = (currentElement + 1);
-        for (USize i = index; i < size; ++i, ++currentElement, ++nextElement)
-        {
-            if constexpr (Moveable<Type>)
-            {
-                currentElement->move(*nextElement);
-            }
-            else if constexpr (Copyable<Type>)
-            {
-                currentElement->copy(*nextElement);
-
-                if constexpr (Finalizable<Type>) // This is not necessary, but if someone doesn't want to have move, this should help avoid leaks
-                {
-                    nextElement->finalize();
-                }
-            } else {
-                *currentElement = *nextElement;
-            }
-        }
+        shift_left(index);
 
         --size;
 
@@ -496,6 +406,11 @@ public:
     [[nodiscard("Use remove_swap")]]
     Type pop_swap(USize index)
     {
+        if (index == size - 1)
+        {
+            return pop_back();
+        }
+
         Type element; 
 
         if constexpr (Moveable<Type>)
@@ -516,19 +431,19 @@ public:
 
         if constexpr (Moveable<Type>)
         {
-            elements[index].move(elements[size]);
+            elements[index].move(elements[size - 1]);
         }
         else if constexpr (Copyable<Type>)
         {
-            elements[index].copy(elements[size]);
+            elements[index].copy(elements[size - 1]);
 
             if constexpr (Finalizable<Type>)
             {
-                elements[size].finalize();
+                elements[size - 1].finalize();
             }
         }
         else {
-            elements[index] = elements[size];
+            elements[index] = elements[size - 1];
         }
 
         --size;
@@ -537,6 +452,29 @@ public:
     }
 
 
+    Void set_growth_policy(const EGrowthPolicy policy) noexcept
+    {
+        growthPolicy = policy;
+    }
+
+    [[nodiscard]]
+    EGrowthPolicy get_growth_policy() const noexcept
+    {
+        return growthPolicy;
+    }
+
+    [[nodiscard]]
+    USize get_reallocation_count() const noexcept
+    {
+        return reallocationCount;
+    }
+
+    [[nodiscard]]
+    AllocatorInfo *get_allocator_info() const noexcept
+    {
+        return allocatorInfo;
+    }
+
     [[nodiscard]]
     USize get_capacity() const noexcept
     {
@@ -590,19 +528,26 @@ public:
         assert(&source != this && "Tried to move dynamic array into itself!");
 
         finalize();
-        elements      = source.elements;
-        capacity      = source.capacity;
-        size          = source.size;
-        allocatorInfo = source.allocatorInfo;
+        elements          = source.elements;
+        capacity          = source.capacity;
+        size              = source.size;
+        allocatorInfo     = source.allocatorInfo;
+        growthPolicy      = source.growthPolicy;
+        reallocationCount = source.reallocationCount;
 
         source = {};
     }
 
-    Void copy(const DynamicArray &source) const noexcept
+    Void copy(const DynamicArray &source) noexcept
     {
         assert(&source != this && "Tried to copy dynamic array into itself!");
 
         finalize();
+        if (!source.elements)
+        {
+            initialize(source.allocatorInfo);
+            return;
+        }
         initialize(source.capacity, source.allocatorInfo);
 
         size = source.size;
@@ -611,7 +556,7 @@ public:
         {
             Type *data = elements;
             const Type *sourceData = source.elements;
-            const Type *sourceDataEnd = elements + size;
+            const Type *sourceDataEnd = source.elements + size;
             for (; sourceData < sourceDataEnd; ++data, ++sourceData)
             {
                 data->copy(*sourceData);
@@ -623,7 +568,11 @@ public:
 
     Void fill(const Type &value) noexcept
     {
-        if constexpr (Copyable<Type>)
+        if constexpr (Simd::Arithmetic<Type>)
+        {
+            Simd::fill(elements, size, value);
+        }
+        else if constexpr (Copyable<Type>)
         {
             Type *data = elements;
             const Type *dataEnd = elements + size;
@@ -636,7 +585,7 @@ public:
             const Type *dataEnd = elements + size;
             for (; data < dataEnd; ++data)
             {
-                data = value;
+                *data = value;
             }
         }
     }
@@ -644,7 +593,11 @@ public:
     Void fill(USize begin, const USize end, const Type &value) noexcept
     {
         assert(begin < size && end <= size);
-        if constexpr (Copyable<Type>)
+        if constexpr (Simd::Arithmetic<Type>)
+        {
+            Simd::fill(elements + begin, end - begin, value);
+        }
+        else if constexpr (Copyable<Type>)
         {
             Type *data = elements + begin;
             const Type *dataEnd = elements + end;
@@ -657,7 +610,7 @@ public:
             const Type *dataEnd = elements + end;
             for (; data < dataEnd; ++data)
             {
-                data = value;
+                *data = value;
             }
         }
     }
@@ -665,7 +618,7 @@ public:
     Void swap(USize left, USize right) noexcept
     {
         assert(left < size && right < size);
-        const Type &temporary = elements[left];
+        const Type temporary = elements[left];
         elements[left] = elements[right];
         elements[right] = temporary;
     }
@@ -673,7 +626,11 @@ public:
     [[nodiscard]]
     Bool contains(const Type &value) const noexcept
     {
-        if constexpr (std::is_trivial_v<Type> && sizeof(Type) == 1)
+        if constexpr (Simd::Arithmetic<Type>)
+        {
+            return Simd::contains(elements, size, value);
+        }
+        else if constexpr (std::is_trivial_v<Type> && sizeof(Type) == 1)
         {
             return memchr(elements, value, size) != nullptr;
         } else {
@@ -765,4 +722,78 @@ public:
 
         *this = {};
     }
+
+private:
+    Void grow() noexcept
+    {
+        const USize newCapacity = Memory::grow_capacity(capacity, size + 1, growthPolicy);
+        ++reallocationCount;
+#ifndef NDEBUG
+        SPDLOG_DEBUG("Reallocation during append, try reserve more memory: {}", newCapacity);
+#endif
+        reserve(newCapacity);
+    }
+
+    // Moves elements from index one place right, element at index is left default constructed
+    Void shift_right(const USize index) noexcept
+    {
+        if constexpr (Relocatable<Type>)
+        {
+            memmove(elements + index + 1, elements + index, (size - index) * sizeof(Type));
+            Memory::start_object<Type>(byte_cast(elements + index));
+        } else {
+            Type* currentElement = &elements[size];
+            Type* previousElement = (currentElement - 1);
+            for (USize i = size; i > index; --i, --currentElement, --previousElement)
+            {
+                if constexpr (Moveable<Type>)
+                {
+                    currentElement->move(*previousElement);
+                }
+                else if constexpr (Copyable<Type>)
+                {
+                    currentElement->copy(*previousElement);
+
+                    if constexpr (Finalizable<Type>) // This is not necessary, but if someone doesn't want to have move, this should help avoid leaks
+                    {
+                        previousElement->finalize();
+                    }
+                } else {
+                    *currentElement = *previousElement;
+                }
+            }
+        }
+    }
+
+    // Moves elements after index one place left over already finalized element at index,
+    // last element is left default constructed
+    Void shift_left(const USize index) noexcept
+    {
+        if constexpr (Relocatable<Type>)
+        {
+            memmove(elements + index, elements + index + 1, (size - index - 1) * sizeof(Type));
+            Memory::start_object<Type>(byte_cast(elements + size - 1));
+        } else {
+            Type* currentElement = &elements[index];
+            Type* nextElement = (currentElement + 1);
+            for (USize i = index + 1; i < size; ++i, ++currentElement, ++nextElement)
+            {
+                if constexpr (Moveable<Type>)
+                {
+                    currentElement->move(*nextElement);
+                }
+                else if constexpr (Copyable<Type>)
+                {
+                    currentElement->copy(*nextElement);
+
+                    if constexpr (Finalizable<Type>) // This is not necessary, but if someone doesn't want to have move, this should help avoid leaks
+                    {
+                        nextElement->finalize();
+                    }
+                } else {
+                    *currentElement = *nextElement;
+                }
+            }
+        }
+    }
 };
\ No newline at end of file
@@ -0,0 +1,438 @@
+#pragma once
+#include "dynamic_array.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/search.hpp"
+#include "Serrate/Utilities/sort.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+// Map stored as two sorted arrays, keys are contiguous so lookup is branchless binary search over cache
+// friendly memory. Single inserts shift the tail, so bulk data should go through insert_range or append.
+// Appended entries stay unsorted after sorted part until next non-const lookup merges them in one pass,
+// const lookups expect that sort() was already called.
+template <Ordered KeyType, Manual ValueType>
+requires Manual<KeyType>
+class FlatMap
+{
+private:
+    static constexpr Bool HAS_VALUES = !std::is_empty_v<ValueType>;
+
+    // Without values, every value reference points here
+    inline static ValueType emptyValue = {};
+
+public:
+    struct InsertResult
+    {
+        ValueType &value;
+        Bool       isInserted;
+    };
+
+    struct Iterator
+    {
+    private:
+        const FlatMap *map;
+        USize          index;
+
+    public:
+        Iterator() noexcept
+        : map(nullptr)
+        , index(0)
+        {}
+
+        Iterator(const FlatMap *initialMap, const USize initialIndex) noexcept
+        : map(initialMap)
+        , index(initialIndex)
+        {}
+
+        [[nodiscard]]
+        const KeyType &get_key() const noexcept
+        {
+            return map->keys[index];
+        }
+
+        [[nodiscard]]
+        ValueType &get_value() const noexcept
+        {
+            return const_cast<FlatMap *>(map)->get_value_at(index);
+        }
+
+        [[nodiscard]]
+        USize get_index() const noexcept
+        {
+            return index;
+        }
+
+        Void operator++() noexcept
+        {
+            ++index;
+        }
+
+        Void operator--() noexcept
+        {
+            --index;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return index == other.index;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return index != other.index;
+        }
+    };
+
+private:
+    DynamicArray<KeyType>   keys;
+    DynamicArray<ValueType> values;
+    USize                   sortedCount;
+
+public:
+    FlatMap() noexcept
+    : keys()
+    , values()
+    , sortedCount(0)
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        keys.initialize(allocator);
+        values.initialize(allocator);
+        sortedCount = 0;
+    }
+
+    Void initialize(const USize initialCapacity,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        initialize(allocator);
+        reserve(initialCapacity);
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        const USize capacity = std::max(newCapacity, USize(2));
+        keys.reserve(capacity);
+        if constexpr (HAS_VALUES)
+        {
+            values.reserve(capacity);
+        }
+    }
+
+    [[nodiscard]]
+    ValueType *find(const KeyType &key) noexcept
+    {
+        sort();
+        const USize index = Search::find(get_keys(), keys.get_size(), key);
+        return index != ~USize(0) ? &get_value_at(index) : nullptr;
+    }
+
+    [[nodiscard]]
+    const ValueType *find(const KeyType &key) const noexcept
+    {
+        assert(is_sorted() && "Call sort() before const lookup!");
+        return const_cast<FlatMap *>(this)->find(key);
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    [[nodiscard]]
+    ValueType &operator[](const KeyType &key) noexcept
+    {
+        return find_or_insert(key).value;
+    }
+
+    [[nodiscard]]
+    const ValueType &operator[](const KeyType &key) const noexcept
+    {
+        const ValueType *value = find(key);
+        assert(value && "Key not found!");
+        return *value;
+    }
+
+    // Inserts or overwrites value
+    ValueType &push(const KeyType &key, const ValueType &value) noexcept
+    {
+        InsertResult result = find_or_insert(key);
+        if constexpr (HAS_VALUES)
+        {
+            if constexpr (Copyable<ValueType>)
+            {
+                if constexpr (Finalizable<ValueType>)
+                {
+                    result.value.finalize();
+                }
+                result.value.copy(value);
+            } else {
+                result.value = value;
+            }
+        }
+        return result.value;
+    }
+
+    // Inserts default value when key does not exist, isInserted tells which case happened
+    InsertResult find_or_insert(const KeyType &key) noexcept
+    {
+        sort();
+        const USize index = Search::lower_bound(get_keys(), keys.get_size(), key);
+        if (index < keys.get_size() && !(key < keys[index]))
+        {
+            return { get_value_at(index), false };
+        }
+
+        keys.push(key, index);
+        if constexpr (HAS_VALUES)
+        {
+            values.push(ValueType{}, index);
+        }
+        ++sortedCount;
+        return { get_value_at(index), true };
+    }
+
+    // Adds entry without keeping order, it is merged by next sort(). Later entry wins on equal keys.
+    Void append(const KeyType &key, const ValueType &value = {}) noexcept
+    {
+        keys.push_back(key);
+        if constexpr (HAS_VALUES)
+        {
+            values.push_back(value);
+        }
+    }
+
+    // Appends all entries and merges them at once, values can be nullptr for default values
+    Void insert_range(const KeyType *newKeys, const ValueType *newValues, const USize count) noexcept
+    {
+        assert((newKeys || count == 0) && "Invalid pointer!");
+        reserve(keys.get_size() + count);
+        for (USize i = 0; i < count; ++i)
+        {
+            append(newKeys[i], newValues ? newValues[i] : ValueType{});
+        }
+        sort();
+    }
+
+    Bool remove(const KeyType &key) noexcept
+    {
+        sort();
+        const USize index = Search::find(get_keys(), keys.get_size(), key);
+        if (index == ~USize(0))
+        {
+            return false;
+        }
+
+        keys.remove(index);
+        if constexpr (HAS_VALUES)
+        {
+            values.remove(index);
+        }
+        --sortedCount;
+        return true;
+    }
+
+    // Sorts appended entries and merges them with sorted part, runs in O(n + m log m) for m appended entries
+    Void sort() noexcept
+    {
+        const USize size = keys.get_size();
+        if (sortedCount == size)
+        {
+            return;
+        }
+
+        AllocatorInfo *allocator = keys.get_allocator_info();
+        const USize pendingCount = size - sortedCount;
+        DynamicArray<USize> order;
+        order.initialize(std::max(pendingCount, USize(2)), allocator);
+        for (USize i = sortedCount; i < size; ++i)
+        {
+            order.push_back(i);
+        }
+
+        // Stable, so last of equal appended keys is the newest one
+        Sort::stable_sort(order.begin(), pendingCount, [this](const USize left, const USize right)
+        {
+            return keys[left] < keys[right];
+        }, allocator);
+
+        DynamicArray<KeyType> mergedKeys;
+        DynamicArray<ValueType> mergedValues;
+        mergedKeys.initialize(keys.get_capacity(), allocator);
+        if constexpr (HAS_VALUES)
+        {
+            mergedValues.initialize(values.get_capacity(), allocator);
+        } else {
+            mergedValues.initialize(allocator);
+        }
+
+        USize sortedIndex = 0;
+        for (USize i = 0; i < pendingCount; ++i)
+        {
+            const USize pendingIndex = order[i];
+            if (i + 1 < pendingCount && !(keys[pendingIndex] < keys[order[i + 1]]))
+            {
+                continue;
+            }
+
+            while (sortedIndex < sortedCount && keys[sortedIndex] < keys[pendingIndex])
+            {
+                take_entry(mergedKeys, mergedValues, sortedIndex);
+                ++sortedIndex;
+            }
+
+            if (sortedIndex < sortedCount && !(keys[pendingIndex] < keys[sortedIndex]))
+            {
+                ++sortedIndex; // Overwritten by appended entry
+            }
+            take_entry(mergedKeys, mergedValues, pendingIndex);
+        }
+
+        for (; sortedIndex < sortedCount; ++sortedIndex)
+        {
+            take_entry(mergedKeys, mergedValues, sortedIndex);
+        }
+
+        order.finalize();
+        keys.move(mergedKeys);
+        values.move(mergedValues);
+        sortedCount = keys.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_sorted() const noexcept
+    {
+        return sortedCount == keys.get_size();
+    }
+
+    [[nodiscard]]
+    Iterator lower_bound(const KeyType &key) const noexcept
+    {
+        assert(is_sorted() && "Call sort() before const lookup!");
+        return Iterator{ this, Search::lower_bound(get_keys(), keys.get_size(), key) };
+    }
+
+    [[nodiscard]]
+    Iterator upper_bound(const KeyType &key) const noexcept
+    {
+        assert(is_sorted() && "Call sort() before const lookup!");
+        return Iterator{ this, Search::upper_bound(get_keys(), keys.get_size(), key) };
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        assert(is_sorted() && "Call sort() before iteration!");
+        return Iterator{ this, 0 };
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{ this, keys.get_size() };
+    }
+
+    [[nodiscard]]
+    const KeyType &get_key(const USize index) const noexcept
+    {
+        return keys[index];
+    }
+
+    [[nodiscard]]
+    ValueType &get_value(const USize index) noexcept
+    {
+        assert(index < keys.get_size() && "Index out of bounds!");
+        return get_value_at(index);
+    }
+
+    [[nodiscard]]
+    const ValueType &get_value(const USize index) const noexcept
+    {
+        assert(index < keys.get_size() && "Index out of bounds!");
+        return const_cast<FlatMap *>(this)->get_value_at(index);
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return keys.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return keys.is_empty();
+    }
+
+    Void clear() noexcept
+    {
+        keys.clear();
+        values.clear();
+        sortedCount = 0;
+    }
+
+    Void copy(const FlatMap &source) noexcept
+    {
+        assert(this != &source && "Copying into itself!");
+        keys.copy(source.keys);
+        if constexpr (HAS_VALUES)
+        {
+            values.copy(source.values);
+        }
+        sortedCount = source.sortedCount;
+    }
+
+    Void move(FlatMap &source) noexcept
+    {
+        assert(this != &source && "Moving into itself!");
+        keys.move(source.keys);
+        values.move(source.values);
+        sortedCount = source.sortedCount;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        keys.finalize();
+        values.finalize();
+        *this = {};
+    }
+
+private:
+    [[nodiscard]]
+    const KeyType *get_keys() const noexcept
+    {
+        return keys.is_empty() ? nullptr : keys.get_data();
+    }
+
+    [[nodiscard]]
+    ValueType &get_value_at(const USize index) noexcept
+    {
+        if constexpr (HAS_VALUES)
+        {
+            return values[index];
+        } else {
+            return emptyValue;
+        }
+    }
+
+    Void take_entry(DynamicArray<KeyType> &mergedKeys, DynamicArray<ValueType> &mergedValues,
+                    const USize index) noexcept
+    {
+        mergedKeys.emplace_back(keys[index]);
+        if constexpr (HAS_VALUES)
+        {
+            mergedValues.emplace_back(values[index]);
+        }
+    }
+};
\ No newline at end of file
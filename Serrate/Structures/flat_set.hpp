@@ -0,0 +1,191 @@
+#pragma once
+#include "flat_map.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+// FlatMap without values, only sorted key array is stored
+template <Ordered KeyType>
+requires Manual<KeyType>
+class FlatSet
+{
+private:
+    struct Empty {};
+    using Map = FlatMap<KeyType, Empty>;
+
+public:
+    struct Iterator
+    {
+    private:
+        typename Map::Iterator iterator;
+
+    public:
+        Iterator() noexcept
+        : iterator()
+        {}
+
+        Iterator(const typename Map::Iterator &initialIterator) noexcept
+        : iterator(initialIterator)
+        {}
+
+        const KeyType &operator*() const noexcept
+        {
+            return iterator.get_key();
+        }
+
+        const KeyType *operator->() const noexcept
+        {
+            return &iterator.get_key();
+        }
+
+        Void operator++() noexcept
+        {
+            ++iterator;
+        }
+
+        Void operator--() noexcept
+        {
+            --iterator;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return iterator == other.iterator;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return iterator != other.iterator;
+        }
+    };
+
+private:
+    Map map;
+
+public:
+    FlatSet() noexcept
+    : map()
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        map.initialize(allocator);
+    }
+
+    Void initialize(const USize initialCapacity,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        map.initialize(initialCapacity, allocator);
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        map.reserve(newCapacity);
+    }
+
+    // Returns false when key was already present
+    Bool insert(const KeyType &key) noexcept
+    {
+        return map.find_or_insert(key).isInserted;
+    }
+
+    // Adds key without keeping order, it is merged by next sort()
+    Void append(const KeyType &key) noexcept
+    {
+        map.append(key);
+    }
+
+    Void insert_range(const KeyType *keys, const USize count) noexcept
+    {
+        map.insert_range(keys, nullptr, count);
+    }
+
+    Bool remove(const KeyType &key) noexcept
+    {
+        return map.remove(key);
+    }
+
+    Void sort() noexcept
+    {
+        map.sort();
+    }
+
+    [[nodiscard]]
+    Bool is_sorted() const noexcept
+    {
+        return map.is_sorted();
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) noexcept
+    {
+        return map.contains(key);
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return map.contains(key);
+    }
+
+    [[nodiscard]]
+    Iterator lower_bound(const KeyType &key) const noexcept
+    {
+        return Iterator{ map.lower_bound(key) };
+    }
+
+    [[nodiscard]]
+    Iterator upper_bound(const KeyType &key) const noexcept
+    {
+        return Iterator{ map.upper_bound(key) };
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        return Iterator{ map.begin() };
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{ map.end() };
+    }
+
+    [[nodiscard]]
+    const KeyType &operator[](const USize index) const noexcept
+    {
+        return map.get_key(index);
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return map.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return map.is_empty();
+    }
+
+    Void clear() noexcept
+    {
+        map.clear();
+    }
+
+    Void copy(const FlatSet &source) noexcept
+    {
+        map.copy(source.map);
+    }
+
+    Void move(FlatSet &source) noexcept
+    {
+        map.move(source.map);
+    }
+
+    Void finalize() noexcept
+    {
+        map.finalize();
+    }
+};
\ No newline at end of file
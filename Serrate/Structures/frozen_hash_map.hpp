@@ -0,0 +1,535 @@
+#pragma once
+#include "hash_map.hpp"
+#include "string_view.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+// Minimal perfect hashing in CHD (hash and displace) style. Keys are grouped into buckets, every bucket
+// with more than one key gets displacement seed that sends all its keys into free slots,
+// buckets with single key point directly to one of the remaining slots.
+// Lookup is one hash, one displacement read and one slot probe.
+namespace FrozenHash
+{
+    constexpr UInt32 DIRECT_FLAG = 0x80000000u;
+    constexpr UInt32 EMPTY_SLOT  = ~UInt32(0);
+    constexpr UInt32 MAX_SEED    = 1u << 24;
+
+    [[nodiscard]]
+    constexpr UInt64 mix(UInt64 hash, const UInt64 seed) noexcept
+    {
+        hash ^= seed * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 30;
+        hash *= 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94D049BB133111EBULL;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    // Maps hash into [0, range) without division, range has to fit in 32 bits
+    [[nodiscard]]
+    constexpr USize reduce(const UInt64 hash, const USize range) noexcept
+    {
+        return USize(((hash >> 32) * UInt64(range)) >> 32);
+    }
+
+    [[nodiscard]]
+    constexpr USize get_bucket_count(const USize count) noexcept
+    {
+        return count / 3 + 1;
+    }
+
+    // Count of UInt32 needed by build as scratch memory
+    [[nodiscard]]
+    constexpr USize get_scratch_size(const USize count) noexcept
+    {
+        return 2 * get_bucket_count(count) + 1 + count;
+    }
+
+    [[nodiscard]]
+    constexpr USize get_bucket(const UInt64 hash, const USize bucketCount) noexcept
+    {
+        return reduce(mix(hash, 0), bucketCount);
+    }
+
+    [[nodiscard]]
+    constexpr USize get_slot(const UInt64 hash, const UInt32 displacement, const USize count) noexcept
+    {
+        if (displacement & DIRECT_FLAG)
+        {
+            return displacement & ~DIRECT_FLAG;
+        }
+        return reduce(mix(hash, displacement), count);
+    }
+
+    // FNV-1a, used where hash has to be computed at compile time
+    [[nodiscard]]
+    constexpr UInt64 hash_text(const Char *text, const USize size) noexcept
+    {
+        UInt64 hash = 0xCBF29CE484222325ULL;
+        for (USize i = 0; i < size; ++i)
+        {
+            hash ^= UInt64(UInt8(text[i]));
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    // Not constexpr on purpose, reaching it during constant evaluation is compile error in every build
+    inline Void keys_are_duplicated() noexcept
+    {}
+
+    // Fills displacements (get_bucket_count(count) entries) and slots (count entries, slot -> key index).
+    // Returns false when keys cannot be separated, which in practice means duplicated keys.
+    [[nodiscard]]
+    constexpr Bool build(const UInt64 *hashes, const USize count,
+                         UInt32 *displacements, UInt32 *slots, UInt32 *scratch) noexcept
+    {
+        assert(count > 0 && count < DIRECT_FLAG && "Invalid key count!");
+        const USize bucketCount = get_bucket_count(count);
+        UInt32 *bucketSizes  = scratch;
+        UInt32 *bucketBegins = scratch + bucketCount;
+        UInt32 *bucketKeys   = scratch + 2 * bucketCount + 1;
+
+        for (USize i = 0; i < bucketCount; ++i)
+        {
+            bucketSizes[i] = 0;
+            displacements[i] = 0;
+        }
+        for (USize i = 0; i < count; ++i)
+        {
+            slots[i] = EMPTY_SLOT;
+            ++bucketSizes[get_bucket(hashes[i], bucketCount)];
+        }
+
+        UInt32 maxBucketSize = 0;
+        bucketBegins[0] = 0;
+        for (USize i = 0; i < bucketCount; ++i)
+        {
+            bucketBegins[i + 1] = bucketBegins[i] + bucketSizes[i];
+            maxBucketSize = maxBucketSize > bucketSizes[i] ? maxBucketSize : bucketSizes[i];
+            bucketSizes[i] = 0;
+        }
+        for (USize i = 0; i < count; ++i)
+        {
+            const USize bucket = get_bucket(hashes[i], bucketCount);
+            bucketKeys[bucketBegins[bucket] + bucketSizes[bucket]] = UInt32(i);
+            ++bucketSizes[bucket];
+        }
+
+        // Equal hashes share bucket and no seed separates them, fail before searching all seeds
+        for (USize bucket = 0; bucket < bucketCount; ++bucket)
+        {
+            const UInt32 *keys = bucketKeys + bucketBegins[bucket];
+            for (UInt32 i = 1; i < bucketSizes[bucket]; ++i)
+            {
+                for (UInt32 j = 0; j < i; ++j)
+                {
+                    if (hashes[keys[i]] == hashes[keys[j]])
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        // Biggest buckets first, while table is still mostly empty
+        for (UInt32 bucketSize = maxBucketSize; bucketSize > 1; --bucketSize)
+        {
+            for (USize bucket = 0; bucket < bucketCount; ++bucket)
+            {
+                if (bucketSizes[bucket] != bucketSize)
+                {
+                    continue;
+                }
+
+                const UInt32 *keys = bucketKeys + bucketBegins[bucket];
+                Bool isPlaced = false;
+                for (UInt32 seed = 1; seed < MAX_SEED; ++seed)
+                {
+                    UInt32 placed = 0;
+                    for (; placed < bucketSize; ++placed)
+                    {
+                        const USize slot = reduce(mix(hashes[keys[placed]], seed), count);
+                        if (slots[slot] != EMPTY_SLOT)
+                        {
+                            break;
+                        }
+                        slots[slot] = keys[placed];
+                    }
+
+                    if (placed == bucketSize)
+                    {
+                        displacements[bucket] = seed;
+                        isPlaced = true;
+                        break;
+                    }
+
+                    for (UInt32 i = 0; i < placed; ++i)
+                    {
+                        slots[reduce(mix(hashes[keys[i]], seed), count)] = EMPTY_SLOT;
+                    }
+                }
+
+                if (!isPlaced)
+                {
+                    return false;
+                }
+            }
+        }
+
+        USize freeSlot = 0;
+        for (USize bucket = 0; bucket < bucketCount; ++bucket)
+        {
+            if (bucketSizes[bucket] != 1)
+            {
+                continue;
+            }
+
+            while (slots[freeSlot] != EMPTY_SLOT)
+            {
+                ++freeSlot;
+            }
+            slots[freeSlot] = bucketKeys[bucketBegins[bucket]];
+            displacements[bucket] = DIRECT_FLAG | UInt32(freeSlot);
+        }
+
+        return true;
+    }
+}
+
+// Read only map built once from final key set, keys and values live in one flat array ordered by slot.
+// Always initialize and finalize.
+template <Hashable KeyType, Manual ValueType>
+class FrozenHashMap
+{
+public:
+    struct Entry
+    {
+        KeyType   key;
+        ValueType value;
+    };
+
+private:
+    AllocatorInfo *allocatorInfo;
+    Entry         *entries;
+    UInt32        *displacements;
+    USize          size;
+    USize          bucketCount;
+
+public:
+    FrozenHashMap() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , entries(nullptr)
+    , displacements(nullptr)
+    , size(0)
+    , bucketCount(0)
+    {}
+
+    // Returns false when keys contain duplicates, map stays empty then
+    [[nodiscard]]
+    Bool initialize(const KeyType *keys, const ValueType *values, const USize count,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(((keys && values) || count == 0) && "Invalid pointer!");
+        return build(count, allocator,
+                     [keys](const USize index) -> const KeyType & { return keys[index]; },
+                     [values](const USize index) -> const ValueType & { return values[index]; });
+    }
+
+    [[nodiscard]]
+    Bool initialize(const HashMap<KeyType, ValueType> &source,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        using Node = typename HashMap<KeyType, ValueType>::Node;
+        const USize count = source.get_size();
+        if (count == 0)
+        {
+            finalize();
+            allocatorInfo = allocator;
+            return true;
+        }
+
+        Node **nodes = allocate_array<Node *>(allocator, count);
+        USize index = 0;
+        for (auto iterator = source.begin(); iterator != source.end(); ++iterator)
+        {
+            nodes[index++] = iterator.get_node();
+        }
+
+        const Bool isBuilt = build(count, allocator,
+                                   [nodes](const USize i) -> const KeyType & { return nodes[i]->key; },
+                                   [nodes](const USize i) -> const ValueType & { return nodes[i]->value; });
+        Memory::deallocate(allocator, nodes);
+        return isBuilt;
+    }
+
+    [[nodiscard]]
+    const ValueType *find(const KeyType &key) const noexcept
+    {
+        const USize slot = get_index(key);
+        return slot != ~USize(0) ? &entries[slot].value : nullptr;
+    }
+
+    [[nodiscard]]
+    const ValueType *find(const StringView &key) const noexcept
+    requires std::is_same_v<KeyType, String>
+    {
+        const USize slot = get_index(key);
+        return slot != ~USize(0) ? &entries[slot].value : nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return get_index(key) != ~USize(0);
+    }
+
+    [[nodiscard]]
+    Bool contains(const StringView &key) const noexcept
+    requires std::is_same_v<KeyType, String>
+    {
+        return get_index(key) != ~USize(0);
+    }
+
+    [[nodiscard]]
+    const ValueType &operator[](const KeyType &key) const noexcept
+    {
+        const USize slot = get_index(key);
+        assert(slot != ~USize(0) && "Given key does not exists in map!");
+        return entries[slot].value;
+    }
+
+    // Position of key in entries, ~USize(0) if key does not exist
+    [[nodiscard]]
+    USize get_index(const KeyType &key) const noexcept
+    {
+        return probe(hash_key(key), key);
+    }
+
+    [[nodiscard]]
+    USize get_index(const StringView &key) const noexcept
+    requires std::is_same_v<KeyType, String>
+    {
+        return probe(key.hash(), key);
+    }
+
+    [[nodiscard]]
+    const Entry *begin() const noexcept
+    {
+        return entries;
+    }
+
+    [[nodiscard]]
+    const Entry *end() const noexcept
+    {
+        return entries + size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if (!entries)
+        {
+            *this = {};
+            return;
+        }
+
+        if constexpr (Finalizable<KeyType> || Finalizable<ValueType>)
+        {
+            for (Entry *entry = entries; entry < entries + size; ++entry)
+            {
+                if constexpr (Finalizable<KeyType>)
+                {
+                    entry->key.finalize();
+                }
+                if constexpr (Finalizable<ValueType>)
+                {
+                    entry->value.finalize();
+                }
+            }
+        }
+
+        Memory::deallocate(allocatorInfo, entries);
+        Memory::deallocate(allocatorInfo, displacements);
+        *this = {};
+    }
+
+private:
+    template <typename Key>
+    [[nodiscard]]
+    USize probe(const UInt64 hash, const Key &key) const noexcept
+    {
+        if (size == 0)
+        {
+            return ~USize(0);
+        }
+
+        const UInt32 displacement = displacements[FrozenHash::get_bucket(hash, bucketCount)];
+        const USize slot = FrozenHash::get_slot(hash, displacement, size);
+        return entries[slot].key == key ? slot : ~USize(0);
+    }
+
+    template <Manual Type>
+    [[nodiscard]]
+    static Type *allocate_array(AllocatorInfo *allocator, const USize count) noexcept
+    {
+        return count == 1 ? Memory::allocate<Type>(allocator) : Memory::allocate<Type>(allocator, count);
+    }
+
+    template <typename KeyAt, typename ValueAt>
+    Bool build(const USize count, AllocatorInfo *allocator, KeyAt keyAt, ValueAt valueAt) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        finalize();
+        allocatorInfo = allocator;
+        if (count == 0)
+        {
+            return true;
+        }
+
+        UInt64 *hashes  = allocate_array<UInt64>(allocatorInfo, count);
+        UInt32 *slots   = allocate_array<UInt32>(allocatorInfo, count);
+        UInt32 *scratch = allocate_array<UInt32>(allocatorInfo, FrozenHash::get_scratch_size(count));
+        for (USize i = 0; i < count; ++i)
+        {
+            hashes[i] = hash_key(keyAt(i));
+        }
+
+        bucketCount = FrozenHash::get_bucket_count(count);
+        displacements = allocate_array<UInt32>(allocatorInfo, bucketCount);
+        const Bool isBuilt = FrozenHash::build(hashes, count, displacements, slots, scratch);
+        if (isBuilt)
+        {
+            size = count;
+            entries = allocate_array<Entry>(allocatorInfo, count);
+            for (USize slot = 0; slot < count; ++slot)
+            {
+                Entry &entry = entries[slot];
+                if constexpr (Copyable<KeyType>)
+                {
+                    entry.key.copy(keyAt(slots[slot]));
+                } else {
+                    entry.key = keyAt(slots[slot]);
+                }
+
+                if constexpr (Copyable<ValueType>)
+                {
+                    entry.value.copy(valueAt(slots[slot]));
+                } else {
+                    entry.value = valueAt(slots[slot]);
+                }
+            }
+        } else {
+            Memory::deallocate(allocatorInfo, displacements);
+            displacements = nullptr;
+            bucketCount = 0;
+        }
+
+        Memory::deallocate(allocatorInfo, scratch);
+        Memory::deallocate(allocatorInfo, slots);
+        Memory::deallocate(allocatorInfo, hashes);
+        return isBuilt;
+    }
+};
+
+// Perfect hash index of string literals computed at compile time, maps every key to its position
+// in the constructor list, so values can be kept in plain Array next to it:
+//     constexpr FrozenStringIndex names{ { "position", "normal", "uv" } };
+//     names.get_index("normal") == 1
+template <USize Count>
+requires (Count > 0)
+class FrozenStringIndex
+{
+private:
+    static constexpr USize BUCKET_COUNT = FrozenHash::get_bucket_count(Count);
+
+    const Char *keys[Count];
+    USize       keySizes[Count];
+    UInt32      slotKeys[Count];
+    UInt32      displacements[BUCKET_COUNT];
+
+public:
+    consteval FrozenStringIndex(const Char *const (&names)[Count])
+    : keys{}
+    , keySizes{}
+    , slotKeys{}
+    , displacements{}
+    {
+        UInt64 hashes[Count]{};
+        UInt32 scratch[FrozenHash::get_scratch_size(Count)]{};
+        for (USize i = 0; i < Count; ++i)
+        {
+            keys[i] = names[i];
+            keySizes[i] = 0;
+            while (names[i][keySizes[i]] != Char())
+            {
+                ++keySizes[i];
+            }
+            hashes[i] = FrozenHash::hash_text(keys[i], keySizes[i]);
+        }
+
+        if (!FrozenHash::build(hashes, Count, displacements, slotKeys, scratch))
+        {
+            FrozenHash::keys_are_duplicated();
+        }
+    }
+
+    // Position of key in constructor list, ~USize(0) if key does not exist
+    [[nodiscard]]
+    constexpr USize get_index(const Char *text, const USize size) const noexcept
+    {
+        const UInt64 hash = FrozenHash::hash_text(text, size);
+        const UInt32 displacement = displacements[FrozenHash::get_bucket(hash, BUCKET_COUNT)];
+        const USize key = slotKeys[FrozenHash::get_slot(hash, displacement, Count)];
+        if (keySizes[key] != size)
+        {
+            return ~USize(0);
+        }
+
+        for (USize i = 0; i < size; ++i)
+        {
+            if (keys[key][i] != text[i])
+            {
+                return ~USize(0);
+            }
+        }
+        return key;
+    }
+
+    [[nodiscard]]
+    USize get_index(const StringView &key) const noexcept
+    {
+        return get_index(key.get_data(), key.get_size());
+    }
+
+    [[nodiscard]]
+    constexpr Bool contains(const Char *text, const USize size) const noexcept
+    {
+        return get_index(text, size) != ~USize(0);
+    }
+
+    [[nodiscard]]
+    Bool contains(const StringView &key) const noexcept
+    {
+        return get_index(key) != ~USize(0);
+    }
+
+    [[nodiscard]]
+    static constexpr USize get_size() noexcept
+    {
+        return Count;
+    }
+};
\ No newline at end of file
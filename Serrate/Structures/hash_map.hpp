@@ -3,6 +3,7 @@
 #include "Serrate/Utilities/types.hpp"
 #include "Serrate/Utilities/cryptography.hpp"
 #include "Serrate/Memory/memory_utils.hpp"
+#include "Serrate/Memory/node_slab.hpp"
 
 #include <algorithm>
 
@@ -25,6 +26,18 @@ concept FunctionHashable = requires(Type &element)
 template<typename Type>
 concept Hashable = MethodHashable<Type> || FunctionHashable<Type>;
 
+template <Hashable KeyType>
+[[nodiscard]]
+UInt64 hash_key(const KeyType &key) noexcept
+{
+    if constexpr (FunctionHashable<KeyType>)
+    {
+        return Cryptography::hash(key);
+    } else {
+        return key.hash();
+    }
+}
+
 
 template <Hashable KeyType, Manual ValueType>
 class HashMap
@@ -47,6 +60,12 @@ public:
         {}
     };
 
+    struct InsertResult
+    {
+        ValueType &value;
+        Bool       isInserted;
+    };
+
     struct Iterator
     {
         
@@ -116,8 +135,11 @@ public:
     };
 
 private:
+    // Lookups resolved together by *_batch methods, their memory latency overlaps inside the group
+    static constexpr USize BATCH_SIZE = 16;
+
     AllocatorInfo *bucketsAllocatorInfo;
-    AllocatorInfo *nodesAllocatorInfo;
+    NodeSlab<Node> nodes;
     Node          **buckets;
     Node          *sentinel; // Global list of nodes
     USize         capacity;
@@ -127,7 +149,7 @@ private:
 public:
     HashMap() noexcept
     : bucketsAllocatorInfo(AllocatorInfo::get_default_allocator())
-    , nodesAllocatorInfo(AllocatorInfo::get_default_allocator())
+    , nodes()
     , buckets(nullptr)
     , sentinel(nullptr)
     , capacity(0)
@@ -140,12 +162,12 @@ public:
     {
         assert(bucketsAllocator && nodesAllocator && "Allocator is nullptr!");
         bucketsAllocatorInfo = bucketsAllocator;
-        nodesAllocatorInfo = nodesAllocator;
+        nodes.initialize(nodesAllocator);
         buckets = nullptr;
         capacity = 0;
         size = 0;
         maxLoadFactor = 1.0f;
-        sentinel = Memory::allocate<Node, false>(nodesAllocatorInfo);
+        sentinel = nodes.allocate_uninitialized();
         sentinel->elementNext = sentinel;
         sentinel->elementPrevious = sentinel;
     }
@@ -157,7 +179,7 @@ public:
         assert(bucketsAllocator && nodesAllocator && "Allocator is nullptr!");
         assert(initialCapacity > 0 && "Initial capacity should be bigger than 0!");
         bucketsAllocatorInfo = bucketsAllocator;
-        nodesAllocatorInfo = nodesAllocator;
+        nodes.initialize(nodesAllocator);
         if (initialCapacity < USize(32))
         {
             capacity = USize(32);
@@ -168,14 +190,14 @@ public:
         size = 0;
         maxLoadFactor = 1.0f;
         buckets = Memory::allocate<Node*>(bucketsAllocatorInfo, capacity);
-        sentinel = Memory::allocate<Node, false>(nodesAllocatorInfo);
+        sentinel = nodes.allocate_uninitialized();
         sentinel->elementNext = sentinel;
         sentinel->elementPrevious = sentinel;
     }
 
     Void reserve(const USize newCapacity)
     {
-        assert(bucketsAllocatorInfo && nodesAllocatorInfo && "Allocator is nullptr!");
+        assert(bucketsAllocatorInfo && nodes.get_allocator_info() && "Allocator is nullptr!");
         assert(newCapacity > 0 && "New capacity should be bigger than 0!");
         if (newCapacity < capacity)
         {
@@ -188,240 +210,123 @@ public:
 
     ValueType &push(const KeyType &key, const ValueType &value) noexcept
     {
-        if (size >= capacity * maxLoadFactor || capacity == 0)
-        {
-            rehash();
-        }
-
-        UInt64 hash;
-        if constexpr (FunctionHashable<KeyType>)
-        {
-            hash = Cryptography::hash(key);
-        } else {
-            hash = key.hash();
-        }
-
-        USize index = hash & (capacity - 1);
-        Node *current = buckets[index];
+        return push(key, value, hash_key(key));
+    }
 
-        while (current != nullptr) // Check if exists
+    // Hash has to be equal to hash_key(key), it lets caller hash key once for many operations
+    ValueType &push(const KeyType &key, const ValueType &value, const UInt64 hash) noexcept
+    {
+        Bool isInserted;
+        Node *target = find_or_link(key, hash, isInserted);
+        if (isInserted)
         {
-            if (current->key == key) 
+            if constexpr (Copyable<KeyType>)
             {
-                if constexpr (Copyable<ValueType>) 
-                {
-                    current->value.copy(value);
-                } else {
-                    current->value = value;
-                }
-                return current->value;
+                target->key.copy(key);
+            } else {
+                target->key = key;
             }
-            current = current->bucketNext;
-        }
-
-        Node *newNode = Memory::allocate<Node>(nodesAllocatorInfo);
-
-        if constexpr (Copyable<KeyType>)
-        {
-            newNode->key.copy(key);
-        } else {
-            newNode->key = key;
         }
 
         if constexpr (Copyable<ValueType>)
         {
-            newNode->value.copy(value);
+            target->value.copy(value);
         } else {
-            newNode->value = value;
+            target->value = value;
         }
-
-        newNode->bucketNext = buckets[index];
-        buckets[index] = newNode;
-
-        newNode->elementNext = sentinel->elementNext;
-        newNode->elementPrevious = sentinel;
-        sentinel->elementNext->elementPrevious = newNode;
-        sentinel->elementNext = newNode;
-
-        ++size;
-        return newNode->value;
+        return target->value;
     }
 
     ValueType &emplace(KeyType &key, ValueType &value) noexcept
     {
-        if (size >= capacity * maxLoadFactor || capacity == 0)
-        {
-            rehash();
-        }
-
-        UInt64 hash;
-        if constexpr (FunctionHashable<KeyType>)
-        {
-            hash = Cryptography::hash(key);
-        } else {
-            hash = key.hash();
-        }
-
-        USize index = hash & (capacity - 1);
-        Node *current = buckets[index];
-
-        while (current != nullptr) // Check if exists
-        {
-            if (current->key == key) 
-            {
-                if constexpr (Moveable<ValueType>) 
-                {
-                    current->value.move(value);
-                }
-                else if constexpr (Copyable<ValueType>) 
-                {
-                    current->value.copy(value);
-                } else {
-                    current->value = value;
-                }
-                return current->value;
-            }
-            current = current->bucketNext;
-        }
-
-        Node *newNode = Memory::allocate<Node>(nodesAllocatorInfo);
+        return emplace(key, value, hash_key(key));
+    }
 
-        if constexpr (Moveable<KeyType>)
-        {
-            newNode->key.move(key);
-        }
-        else if constexpr (Copyable<KeyType>)
+    ValueType &emplace(KeyType &key, ValueType &value, const UInt64 hash) noexcept
+    {
+        Bool isInserted;
+        Node *target = find_or_link(key, hash, isInserted);
+        if (isInserted)
         {
-            newNode->key.copy(key);
-        } else {
-            newNode->key = key;
+            emplace_key(target, key);
         }
 
         if constexpr (Moveable<ValueType>)
         {
-            newNode->value.move(value);
-        } 
+            target->value.move(value);
+        }
         else if constexpr (Copyable<ValueType>)
         {
-            newNode->value.copy(value);
+            target->value.copy(value);
         } else {
-            newNode->value = value;
+            target->value = value;
         }
-
-        newNode->bucketNext = buckets[index];
-        buckets[index] = newNode;
-
-        newNode->elementNext = sentinel->elementNext;
-        newNode->elementPrevious = sentinel;
-        sentinel->elementNext->elementPrevious = newNode;
-        sentinel->elementNext = newNode;
-
-        ++size;
-        return newNode->value;
+        return target->value;
     }
 
-    ValueType &operator[](KeyType &key) noexcept
+    // Inserts default value when key does not exist, isInserted tells which case happened
+    InsertResult find_or_insert(const KeyType &key) noexcept
     {
-        if (size >= USize(Float32(capacity) * maxLoadFactor) || capacity == 0)
-        {
-            rehash();
-        }
-
-        UInt64 hash;
-        if constexpr (FunctionHashable<KeyType>)
-        {
-            hash = Cryptography::hash(key);
-        } else {
-            hash = key.hash();
-        }
-
-        USize index = hash & (capacity - 1);
-        Node *current = buckets[index];
+        return find_or_insert(key, hash_key(key));
+    }
 
-        while (current != nullptr) // Check if exists
+    InsertResult find_or_insert(const KeyType &key, const UInt64 hash) noexcept
+    {
+        Bool isInserted;
+        Node *target = find_or_link(key, hash, isInserted);
+        if (isInserted)
         {
-            if (current->key == key)
+            if constexpr (Copyable<KeyType>)
             {
-                return current->value;
+                target->key.copy(key);
+            } else {
+                target->key = key;
             }
-            current = current->bucketNext;
-        }
-
-        Node *newNode = Memory::allocate<Node>(nodesAllocatorInfo);
-
-        if constexpr (Moveable<KeyType>)
-        {
-            newNode->key.move(key);
         }
-        else if constexpr (Copyable<KeyType>)
-        {
-            newNode->key.copy(key);
-        } else {
-            newNode->key = key;
-        }
-
-        newNode->value = ValueType{};
-
-        newNode->bucketNext = buckets[index];
-        buckets[index] = newNode;
-
-        newNode->elementNext = sentinel->elementNext;
-        newNode->elementPrevious = sentinel;
-        sentinel->elementNext->elementPrevious = newNode;
-        sentinel->elementNext = newNode;
-
-        ++size;
-        return newNode->value;
+        return { target->value, isInserted };
     }
 
-    ValueType &operator[](const KeyType &key) noexcept
+    // Key and value are moved in only when key does not exist, otherwise both are left untouched
+    InsertResult try_emplace(KeyType &key, ValueType &value) noexcept
     {
-        if (size >= USize(Float32(capacity) * maxLoadFactor) || capacity == 0)
-        {
-            rehash();
-        }
-
-        UInt64 hash;
-        if constexpr (FunctionHashable<KeyType>)
-        {
-            hash = Cryptography::hash(key);
-        } else {
-            hash = key.hash();
-        }
-
-        USize index = hash & (capacity - 1);
-        Node *current = buckets[index];
+        return try_emplace(key, value, hash_key(key));
+    }
 
-        while (current != nullptr) // Check if exists
+    InsertResult try_emplace(KeyType &key, ValueType &value, const UInt64 hash) noexcept
+    {
+        Bool isInserted;
+        Node *target = find_or_link(key, hash, isInserted);
+        if (isInserted)
         {
-            if (current->key == key)
+            emplace_key(target, key);
+            if constexpr (Moveable<ValueType>)
             {
-                return current->value;
+                target->value.move(value);
+            }
+            else if constexpr (Copyable<ValueType>)
+            {
+                target->value.copy(value);
+            } else {
+                target->value = value;
             }
-            current = current->bucketNext;
         }
+        return { target->value, isInserted };
+    }
 
-        Node *newNode = Memory::allocate<Node>(nodesAllocatorInfo);
-
-        if constexpr (Copyable<KeyType>)
+    ValueType &operator[](KeyType &key) noexcept
+    {
+        Bool isInserted;
+        Node *target = find_or_link(key, hash_key(key), isInserted);
+        if (isInserted)
         {
-            newNode->key.copy(key);
-        } else {
-            newNode->key = key;
+            emplace_key(target, key);
         }
+        return target->value;
+    }
 
-        newNode->value = ValueType{};
-
-        newNode->bucketNext = buckets[index];
-        buckets[index] = newNode;
-
-        newNode->elementNext = sentinel->elementNext;
-        newNode->elementPrevious = sentinel;
-        sentinel->elementNext->elementPrevious = newNode;
-        sentinel->elementNext = newNode;
-
-        ++size;
-        return newNode->value;
+    ValueType &operator[](const KeyType &key) noexcept
+    {
+        return find_or_insert(key).value;
     }
 
     ValueType &operator[](const StringView &key) noexcept
@@ -535,7 +440,7 @@ public:
                 current->elementNext->elementPrevious = current->elementPrevious;
                 current->elementPrevious->elementNext = current->elementNext;
 
-                Memory::deallocate(nodesAllocatorInfo, current);
+                nodes.deallocate(current);
 
                 --size;
 
@@ -579,7 +484,7 @@ public:
                 current->elementNext->elementPrevious = current->elementPrevious;
                 current->elementPrevious->elementNext = current->elementNext;
 
-                Memory::deallocate(nodesAllocatorInfo, current);
+                nodes.deallocate(current);
 
                 --size;
 
@@ -607,7 +512,7 @@ public:
         size          = source.size;
         maxLoadFactor = source.maxLoadFactor;
         bucketsAllocatorInfo = source.bucketsAllocatorInfo;
-        nodesAllocatorInfo   = source.nodesAllocatorInfo;
+        nodes                = source.nodes;
 
         source = {};
     }
@@ -617,7 +522,7 @@ public:
         assert(&source != this && "Tried to copy hash map into itself!");
 
         finalize();
-        initialize(source.capacity, source.nodesAllocatorInfo, source.bucketsAllocatorInfo);
+        initialize(source.capacity, source.nodes.get_allocator_info(), source.bucketsAllocatorInfo);
 
         maxLoadFactor = source.maxLoadFactor;
 
@@ -630,14 +535,12 @@ public:
     [[nodiscard]]
     Iterator find(const KeyType &key) const noexcept
     {
-        UInt64 hash;
-        if constexpr (FunctionHashable<KeyType>)
-        {
-            hash = Cryptography::hash(key);
-        } else {
-            hash = key.hash();
-        }
+        return find(key, hash_key(key));
+    }
 
+    [[nodiscard]]
+    Iterator find(const KeyType &key, const UInt64 hash) const noexcept
+    {
         USize index = hash & (capacity - 1);
         Node *current = buckets[index];
         while (current != nullptr) // Check if exists
@@ -717,6 +620,113 @@ public:
         return false;
     }
 
+    // Batch methods hash whole group of keys first, prefetch their buckets and nodes
+    // and only then walk the chains, so cache misses of independent lookups overlap
+    Void find_batch(const KeyType *keys, const USize count, Iterator *results) const noexcept
+    {
+        assert(((keys && results) || count == 0) && "Invalid pointer!");
+        if (capacity == 0)
+        {
+            for (USize i = 0; i < count; ++i)
+            {
+                results[i] = end();
+            }
+            return;
+        }
+
+        USize indices[BATCH_SIZE];
+        for (USize offset = 0; offset < count; offset += BATCH_SIZE)
+        {
+            const USize groupSize = std::min(BATCH_SIZE, count - offset);
+            const KeyType *groupKeys = keys + offset;
+            prefetch_group(groupKeys, groupSize, indices);
+
+            for (USize i = 0; i < groupSize; ++i)
+            {
+                Node *found = find_in_bucket(groupKeys[i], indices[i]);
+                results[offset + i] = found ? Iterator{ found } : end();
+            }
+        }
+    }
+
+    Void contains_batch(const KeyType *keys, const USize count, Bool *results) const noexcept
+    {
+        assert(((keys && results) || count == 0) && "Invalid pointer!");
+        if (capacity == 0)
+        {
+            for (USize i = 0; i < count; ++i)
+            {
+                results[i] = false;
+            }
+            return;
+        }
+
+        USize indices[BATCH_SIZE];
+        for (USize offset = 0; offset < count; offset += BATCH_SIZE)
+        {
+            const USize groupSize = std::min(BATCH_SIZE, count - offset);
+            const KeyType *groupKeys = keys + offset;
+            prefetch_group(groupKeys, groupSize, indices);
+
+            for (USize i = 0; i < groupSize; ++i)
+            {
+                results[offset + i] = find_in_bucket(groupKeys[i], indices[i]) != nullptr;
+            }
+        }
+    }
+
+    // Same semantic as push called for every pair, but buckets are grown once for whole batch
+    Void push_batch(const KeyType *keys, const ValueType *values, const USize count) noexcept
+    {
+        assert(((keys && values) || count == 0) && "Invalid pointer!");
+        if (count == 0)
+        {
+            return;
+        }
+
+        const USize requiredSize = size + count;
+        if (capacity == 0 || requiredSize >= USize(Float32(capacity) * maxLoadFactor))
+        {
+            capacity = std::max(capacity, USize(32));
+            while (requiredSize >= USize(Float32(capacity) * maxLoadFactor))
+            {
+                capacity <<= 1;
+            }
+            rehash();
+        }
+
+        USize indices[BATCH_SIZE];
+        for (USize offset = 0; offset < count; offset += BATCH_SIZE)
+        {
+            const USize groupSize = std::min(BATCH_SIZE, count - offset);
+            const KeyType *groupKeys = keys + offset;
+            const ValueType *groupValues = values + offset;
+            prefetch_group(groupKeys, groupSize, indices);
+
+            for (USize i = 0; i < groupSize; ++i)
+            {
+                Node *target = find_in_bucket(groupKeys[i], indices[i]);
+                if (!target)
+                {
+                    target = link_new_node(indices[i]);
+                    if constexpr (Copyable<KeyType>)
+                    {
+                        target->key.copy(groupKeys[i]);
+                    } else {
+                        target->key = groupKeys[i];
+                    }
+                }
+
+                if constexpr (Copyable<ValueType>)
+                {
+                    target->value.copy(groupValues[i]);
+                } else {
+                    target->value = groupValues[i];
+                }
+            }
+        }
+    }
+
     Void set_max_load_factor(const Float32 loadFactor) noexcept
     {
         assert(loadFactor > 0.0f && "This will cause infinite loop!");
@@ -845,7 +855,7 @@ public:
                 toClear->value.finalize();
             }
 
-            Memory::deallocate(nodesAllocatorInfo, toClear);
+            nodes.deallocate(toClear);
         }
 
         sentinel->elementNext = sentinel;
@@ -867,8 +877,91 @@ public:
         }
 
         Memory::deallocate(bucketsAllocatorInfo, buckets);
-        Memory::deallocate(nodesAllocatorInfo, sentinel);
+        nodes.finalize(); // Sentinel is released together with chunks
 
         *this = {};
     }
+
+private:
+    // Computes bucket indices for the group and prefetches buckets, then bucket heads
+    Void prefetch_group(const KeyType *keys, const USize count, USize *indices) const noexcept
+    {
+        for (USize i = 0; i < count; ++i)
+        {
+            indices[i] = hash_key(keys[i]) & (capacity - 1);
+            Memory::prefetch(buckets + indices[i]);
+        }
+
+        for (USize i = 0; i < count; ++i)
+        {
+            if (const Node *head = buckets[indices[i]])
+            {
+                Memory::prefetch(head);
+                Memory::prefetch(&head->key);
+            }
+        }
+    }
+
+    [[nodiscard]]
+    Node *find_in_bucket(const KeyType &key, const USize index) const noexcept
+    {
+        for (Node *current = buckets[index]; current != nullptr; current = current->bucketNext)
+        {
+            if (current->key == key)
+            {
+                return current;
+            }
+        }
+        return nullptr;
+    }
+
+    // Single probe used by all inserting methods, key of inserted node is left for caller to set
+    Node *find_or_link(const KeyType &key, const UInt64 hash, Bool &isInserted) noexcept
+    {
+        if (size >= USize(Float32(capacity) * maxLoadFactor) || capacity == 0)
+        {
+            rehash();
+        }
+
+        const USize index = hash & (capacity - 1);
+        if (Node *found = find_in_bucket(key, index))
+        {
+            isInserted = false;
+            return found;
+        }
+
+        isInserted = true;
+        return link_new_node(index);
+    }
+
+    Void emplace_key(Node *target, KeyType &key) noexcept
+    {
+        if constexpr (Moveable<KeyType>)
+        {
+            target->key.move(key);
+        }
+        else if constexpr (Copyable<KeyType>)
+        {
+            target->key.copy(key);
+        } else {
+            target->key = key;
+        }
+    }
+
+    // Allocates node and links it into bucket and global list, key and value are left default
+    Node *link_new_node(const USize index) noexcept
+    {
+        Node *newNode = nodes.allocate();
+
+        newNode->bucketNext = buckets[index];
+        buckets[index] = newNode;
+
+        newNode->elementNext = sentinel->elementNext;
+        newNode->elementPrevious = sentinel;
+        sentinel->elementNext->elementPrevious = newNode;
+        sentinel->elementNext = newNode;
+
+        ++size;
+        return newNode;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,776 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/byte.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+// Links embedded into object that sits in IntrusiveRBTree. Color is stored in the lowest bit of parent
+// pointer, so hook costs three pointers. Object can have several hooks to be in several trees at once.
+class RBHook
+{
+private:
+    USize   parentAndColor; // Lowest bit set means red
+    RBHook *left;
+    RBHook *right;
+
+public:
+    constexpr RBHook() noexcept
+    : parentAndColor(0)
+    , left(nullptr)
+    , right(nullptr)
+    {}
+
+    [[nodiscard]]
+    RBHook *get_parent() const noexcept
+    {
+        return reinterpret_cast<RBHook *>(parentAndColor & ~USize(1));
+    }
+
+    [[nodiscard]]
+    RBHook *get_left() const noexcept
+    {
+        return left;
+    }
+
+    [[nodiscard]]
+    RBHook *get_right() const noexcept
+    {
+        return right;
+    }
+
+    [[nodiscard]]
+    Bool is_red() const noexcept
+    {
+        return (parentAndColor & USize(1)) != 0;
+    }
+
+    Void set_parent(RBHook *parent) noexcept
+    {
+        parentAndColor = reinterpret_cast<USize>(parent) | (parentAndColor & USize(1));
+    }
+
+    Void set_left(RBHook *leftChild) noexcept
+    {
+        left = leftChild;
+    }
+
+    Void set_right(RBHook *rightChild) noexcept
+    {
+        right = rightChild;
+    }
+
+    Void set_red(const Bool isRed) noexcept
+    {
+        parentAndColor = (parentAndColor & ~USize(1)) | USize(isRed);
+    }
+
+    Void reset() noexcept
+    {
+        parentAndColor = 0;
+        left = nullptr;
+        right = nullptr;
+    }
+};
+
+static_assert(alignof(RBHook) >= 2, "Color bit needs at least 2 byte alignment!");
+
+// Augment recomputes object's subtree data from its children, tree calls it for every node whose subtree
+// changed, bottom up. It has to provide static Void update(Type &object, const Type *left, const Type *right).
+struct RBNoAugment
+{
+    template <typename Type>
+    static Void update(Type &, const Type *, const Type *) noexcept
+    {}
+};
+
+// Default comparator, Compare can also take key types used in find/lower_bound/upper_bound
+struct RBLess
+{
+    template <typename Left, typename Right>
+    Bool operator()(const Left &left, const Right &right) const noexcept
+    {
+        return left < right;
+    }
+};
+
+// Red-black tree over objects owned by caller, it never allocates. Equal objects are allowed and kept in
+// insertion order. Compare has to be default constructible and answer compare(a, b) for a ordered before b.
+// HookOffset is offsetof(Type, hook), so Type has to be standard layout.
+template <typename Type, USize HookOffset, typename Compare = RBLess, typename Augment = RBNoAugment>
+requires std::is_standard_layout_v<Type> && (HookOffset + sizeof(RBHook) <= sizeof(Type))
+class IntrusiveRBTree
+{
+private:
+    static constexpr Bool IS_AUGMENTED = !std::is_same_v<Augment, RBNoAugment>;
+
+    RBHook *root;
+    USize   size;
+
+public:
+    struct Iterator
+    {
+    private:
+        RBHook *hook;
+
+    public:
+        Iterator() noexcept
+        : hook(nullptr)
+        {}
+
+        Iterator(RBHook *initialHook) noexcept
+        : hook(initialHook)
+        {}
+
+        Type &operator*() const noexcept
+        {
+            return *get_object(hook);
+        }
+
+        Type *operator->() const noexcept
+        {
+            return get_object(hook);
+        }
+
+        Void operator++() noexcept
+        {
+            hook = get_next_hook(hook);
+        }
+
+        Void operator--() noexcept
+        {
+            hook = get_previous_hook(hook);
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return hook == other.hook;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return hook != other.hook;
+        }
+    };
+
+    IntrusiveRBTree() noexcept
+    : root(nullptr)
+    , size(0)
+    {}
+
+    Void insert(Type &object) noexcept
+    {
+        RBHook *node = get_hook(object);
+        node->reset();
+        node->set_red(true);
+
+        RBHook *parent = nullptr;
+        Bool isLeft = false;
+        for (RBHook *current = root; current != nullptr;)
+        {
+            parent = current;
+            isLeft = Compare{}(object, *get_object(current));
+            current = isLeft ? current->get_left() : current->get_right();
+        }
+
+        node->set_parent(parent);
+        if (!parent)
+        {
+            root = node;
+        }
+        else if (isLeft)
+        {
+            parent->set_left(node);
+        } else {
+            parent->set_right(node);
+        }
+        ++size;
+
+        if constexpr (IS_AUGMENTED)
+        {
+            update_to_root(node);
+        }
+        fix_insert(node);
+    }
+
+    Void remove(Type &object) noexcept
+    {
+        RBHook *node = get_hook(object);
+        assert(contains(object) && "Object is not in this tree!");
+
+        RBHook *x;
+        RBHook *xParent;
+        Bool isOriginalRed = node->is_red();
+        if (!node->get_left())
+        {
+            x = node->get_right();
+            xParent = node->get_parent();
+            transplant(node, x);
+        }
+        else if (!node->get_right())
+        {
+            x = node->get_left();
+            xParent = node->get_parent();
+            transplant(node, x);
+        } else {
+            RBHook *y = get_min_hook(node->get_right());
+            isOriginalRed = y->is_red();
+            x = y->get_right();
+            if (y->get_parent() == node)
+            {
+                xParent = y;
+            } else {
+                xParent = y->get_parent();
+                transplant(y, x);
+                RBHook *right = node->get_right();
+                y->set_right(right);
+                right->set_parent(y);
+            }
+            transplant(node, y);
+            RBHook *left = node->get_left();
+            y->set_left(left);
+            left->set_parent(y);
+            y->set_red(node->is_red());
+        }
+        --size;
+        node->reset();
+
+        if constexpr (IS_AUGMENTED)
+        {
+            update_to_root(xParent);
+        }
+        if (!isOriginalRed)
+        {
+            fix_remove(x, xParent);
+        }
+    }
+
+    // Recomputes augmented data from object up to root, call after changing data that Augment reads.
+    // Key of object must not change while it is in the tree.
+    Void update(Type &object) noexcept
+    {
+        if constexpr (IS_AUGMENTED)
+        {
+            update_to_root(get_hook(object));
+        }
+    }
+
+    // First object equal to key or nullptr
+    template <typename Key>
+    [[nodiscard]]
+    Type *find(const Key &key) const noexcept
+    {
+        Type *candidate = lower_bound(key);
+        if (candidate && !Compare{}(key, *candidate))
+        {
+            return candidate;
+        }
+        return nullptr;
+    }
+
+    // First object not ordered before key or nullptr
+    template <typename Key>
+    [[nodiscard]]
+    Type *lower_bound(const Key &key) const noexcept
+    {
+        RBHook *best = nullptr;
+        for (RBHook *current = root; current;)
+        {
+            if (Compare{}(*get_object(current), key))
+            {
+                current = current->get_right();
+            } else {
+                best = current;
+                current = current->get_left();
+            }
+        }
+        return best ? get_object(best) : nullptr;
+    }
+
+    // First object ordered after key or nullptr
+    template <typename Key>
+    [[nodiscard]]
+    Type *upper_bound(const Key &key) const noexcept
+    {
+        RBHook *best = nullptr;
+        for (RBHook *current = root; current;)
+        {
+            if (Compare{}(key, *get_object(current)))
+            {
+                best = current;
+                current = current->get_left();
+            } else {
+                current = current->get_right();
+            }
+        }
+        return best ? get_object(best) : nullptr;
+    }
+
+    // Walks parents up to root, so it costs O(log n) instead of search with possibly equal keys
+    [[nodiscard]]
+    Bool contains(const Type &object) const noexcept
+    {
+        const RBHook *node = get_hook(object);
+        while (node->get_parent())
+        {
+            node = node->get_parent();
+        }
+        return node == root && root != nullptr;
+    }
+
+    [[nodiscard]]
+    Type *get_root() const noexcept
+    {
+        return root ? get_object(root) : nullptr;
+    }
+
+    [[nodiscard]]
+    static Type *get_left(const Type &object) noexcept
+    {
+        RBHook *left = get_hook(object)->get_left();
+        return left ? get_object(left) : nullptr;
+    }
+
+    [[nodiscard]]
+    static Type *get_right(const Type &object) noexcept
+    {
+        RBHook *right = get_hook(object)->get_right();
+        return right ? get_object(right) : nullptr;
+    }
+
+    [[nodiscard]]
+    static Type *get_parent(const Type &object) noexcept
+    {
+        RBHook *parent = get_hook(object)->get_parent();
+        return parent ? get_object(parent) : nullptr;
+    }
+
+    [[nodiscard]]
+    Type *get_first() const noexcept
+    {
+        return root ? get_object(get_min_hook(root)) : nullptr;
+    }
+
+    [[nodiscard]]
+    Type *get_last() const noexcept
+    {
+        return root ? get_object(get_max_hook(root)) : nullptr;
+    }
+
+    [[nodiscard]]
+    static Type *get_next(const Type &object) noexcept
+    {
+        RBHook *next = get_next_hook(get_hook(object));
+        return next ? get_object(next) : nullptr;
+    }
+
+    [[nodiscard]]
+    static Type *get_previous(const Type &object) noexcept
+    {
+        RBHook *previous = get_previous_hook(get_hook(object));
+        return previous ? get_object(previous) : nullptr;
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        return Iterator{ root ? get_min_hook(root) : nullptr };
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{};
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    // Forgets all objects without touching them, their hooks stay stale
+    Void clear() noexcept
+    {
+        root = nullptr;
+        size = 0;
+    }
+
+    // Checks ordering, parent links, red rule and black height, used in debug asserts
+    [[nodiscard]]
+    Bool validate() const noexcept
+    {
+        if (!root)
+        {
+            return size == 0;
+        }
+
+        if (root->is_red() || root->get_parent())
+        {
+            return false;
+        }
+
+        USize count = 0;
+        return validate_node(root, count) >= 0 && count == size;
+    }
+
+private:
+    [[nodiscard]]
+    static RBHook *get_hook(const Type &object) noexcept
+    {
+        return reinterpret_cast<RBHook *>(byte_cast(const_cast<Type *>(&object)) + HookOffset);
+    }
+
+    [[nodiscard]]
+    static Type *get_object(const RBHook *hook) noexcept
+    {
+        return reinterpret_cast<Type *>(byte_cast(const_cast<RBHook *>(hook)) - HookOffset);
+    }
+
+    [[nodiscard]]
+    static RBHook *get_min_hook(RBHook *node) noexcept
+    {
+        while (node->get_left())
+        {
+            node = node->get_left();
+        }
+        return node;
+    }
+
+    [[nodiscard]]
+    static RBHook *get_max_hook(RBHook *node) noexcept
+    {
+        while (node->get_right())
+        {
+            node = node->get_right();
+        }
+        return node;
+    }
+
+    [[nodiscard]]
+    static RBHook *get_next_hook(RBHook *node) noexcept
+    {
+        if (node->get_right())
+        {
+            return get_min_hook(node->get_right());
+        }
+
+        RBHook *parent = node->get_parent();
+        while (parent && node == parent->get_right())
+        {
+            node = parent;
+            parent = parent->get_parent();
+        }
+        return parent;
+    }
+
+    [[nodiscard]]
+    static RBHook *get_previous_hook(RBHook *node) noexcept
+    {
+        if (node->get_left())
+        {
+            return get_max_hook(node->get_left());
+        }
+
+        RBHook *parent = node->get_parent();
+        while (parent && node == parent->get_left())
+        {
+            node = parent;
+            parent = parent->get_parent();
+        }
+        return parent;
+    }
+
+    [[nodiscard]]
+    static Bool is_red(const RBHook *node) noexcept
+    {
+        return node && node->is_red();
+    }
+
+    static Void update_node(RBHook *node) noexcept
+    {
+        RBHook *left = node->get_left();
+        RBHook *right = node->get_right();
+        Augment::update(*get_object(node),
+                        left ? get_object(left) : nullptr,
+                        right ? get_object(right) : nullptr);
+    }
+
+    static Void update_to_root(RBHook *node) noexcept
+    {
+        for (; node; node = node->get_parent())
+        {
+            update_node(node);
+        }
+    }
+
+    Void rotate_left(RBHook *node) noexcept
+    {
+        RBHook *child = node->get_right();
+        RBHook *right = child->get_left();
+        node->set_right(right);
+        if (right)
+        {
+            right->set_parent(node);
+        }
+
+        RBHook *parent = node->get_parent();
+        child->set_parent(parent);
+        if (!parent)
+        {
+            root = child;
+        }
+        else if (node == parent->get_left())
+        {
+            parent->set_left(child);
+        } else {
+            parent->set_right(child);
+        }
+        child->set_left(node);
+        node->set_parent(child);
+
+        if constexpr (IS_AUGMENTED)
+        {
+            update_node(node);
+            update_node(child);
+        }
+    }
+
+    Void rotate_right(RBHook *node) noexcept
+    {
+        RBHook *child = node->get_left();
+        RBHook *left = child->get_right();
+        node->set_left(left);
+        if (left)
+        {
+            left->set_parent(node);
+        }
+
+        RBHook *parent = node->get_parent();
+        child->set_parent(parent);
+        if (!parent)
+        {
+            root = child;
+        }
+        else if (node == parent->get_left())
+        {
+            parent->set_left(child);
+        } else {
+            parent->set_right(child);
+        }
+        child->set_right(node);
+        node->set_parent(child);
+
+        if constexpr (IS_AUGMENTED)
+        {
+            update_node(node);
+            update_node(child);
+        }
+    }
+
+    Void transplant(const RBHook *u, RBHook *v) noexcept
+    {
+        RBHook *parent = u->get_parent();
+        if (!parent)
+        {
+            root = v;
+        }
+        else if (u == parent->get_left())
+        {
+            parent->set_left(v);
+        } else {
+            parent->set_right(v);
+        }
+
+        if (v)
+        {
+            v->set_parent(parent);
+        }
+    }
+
+    Void fix_insert(RBHook *node) noexcept
+    {
+        while (node != root && node->is_red() && node->get_parent()->is_red())
+        {
+            RBHook *parent = node->get_parent();
+            RBHook *grandparent = parent->get_parent();
+            if (parent == grandparent->get_left())
+            {
+                RBHook *uncle = grandparent->get_right();
+                if (is_red(uncle))
+                {
+                    grandparent->set_red(true);
+                    parent->set_red(false);
+                    uncle->set_red(false);
+                    node = grandparent;
+                } else {
+                    if (node == parent->get_right())
+                    {
+                        rotate_left(parent);
+                        node = parent;
+                        parent = node->get_parent();
+                    }
+                    rotate_right(grandparent);
+                    const Bool isParentRed = parent->is_red();
+                    parent->set_red(grandparent->is_red());
+                    grandparent->set_red(isParentRed);
+                    node = parent;
+                }
+            } else {
+                RBHook *uncle = grandparent->get_left();
+                if (is_red(uncle))
+                {
+                    grandparent->set_red(true);
+                    parent->set_red(false);
+                    uncle->set_red(false);
+                    node = grandparent;
+                } else {
+                    if (node == parent->get_left())
+                    {
+                        rotate_right(parent);
+                        node = parent;
+                        parent = node->get_parent();
+                    }
+                    rotate_left(grandparent);
+                    const Bool isParentRed = parent->is_red();
+                    parent->set_red(grandparent->is_red());
+                    grandparent->set_red(isParentRed);
+                    node = parent;
+                }
+            }
+        }
+        root->set_red(false);
+    }
+
+    Void fix_remove(RBHook *node, RBHook *parent) noexcept
+    {
+        while (node != root && !is_red(node) && parent)
+        {
+            if (node == parent->get_left())
+            {
+                RBHook *sibling = parent->get_right();
+                // Case 1: Sibling is red
+                if (is_red(sibling))
+                {
+                    sibling->set_red(false);
+                    parent->set_red(true);
+                    rotate_left(parent);
+                    sibling = parent->get_right();
+                }
+
+                // Case 2: Sibling is black with two black children
+                if (!sibling || (!is_red(sibling->get_left()) && !is_red(sibling->get_right())))
+                {
+                    if (sibling)
+                    {
+                        sibling->set_red(true);
+                    }
+                    node = parent;
+                    parent = node->get_parent();
+                } else {
+                    // Case 3: Sibling is black, left child is red, right child is black
+                    if (!is_red(sibling->get_right()))
+                    {
+                        sibling->get_left()->set_red(false);
+                        sibling->set_red(true);
+                        rotate_right(sibling);
+                        sibling = parent->get_right();
+                    }
+
+                    // Case 4: Sibling is black, right child is red
+                    sibling->set_red(parent->is_red());
+                    parent->set_red(false);
+                    sibling->get_right()->set_red(false);
+                    rotate_left(parent);
+                    node = root;
+                }
+            } else {
+                RBHook *sibling = parent->get_left();
+                // Case 1: Sibling is red
+                if (is_red(sibling))
+                {
+                    sibling->set_red(false);
+                    parent->set_red(true);
+                    rotate_right(parent);
+                    sibling = parent->get_left();
+                }
+
+                // Case 2: Sibling is black with two black children
+                if (!sibling || (!is_red(sibling->get_left()) && !is_red(sibling->get_right())))
+                {
+                    if (sibling)
+                    {
+                        sibling->set_red(true);
+                    }
+                    node = parent;
+                    parent = node->get_parent();
+                } else {
+                    // Case 3: Sibling is black, right child is red, left child is black
+                    if (!is_red(sibling->get_left()))
+                    {
+                        sibling->get_right()->set_red(false);
+                        sibling->set_red(true);
+                        rotate_left(sibling);
+                        sibling = parent->get_left();
+                    }
+
+                    // Case 4: Sibling is black, left child is red
+                    sibling->set_red(parent->is_red());
+                    parent->set_red(false);
+                    sibling->get_left()->set_red(false);
+                    rotate_right(parent);
+                    node = root;
+                }
+            }
+        }
+
+        if (node)
+        {
+            node->set_red(false);
+        }
+    }
+
+    // Returns black height of subtree or -1 when it is invalid
+    [[nodiscard]]
+    Int32 validate_node(const RBHook *node, USize &count) const noexcept
+    {
+        if (!node)
+        {
+            return 0;
+        }
+        ++count;
+
+        const RBHook *left = node->get_left();
+        const RBHook *right = node->get_right();
+        if ((left && left->get_parent() != node) || (right && right->get_parent() != node))
+        {
+            return -1;
+        }
+
+        if (node->is_red() && (is_red(left) || is_red(right)))
+        {
+            return -1;
+        }
+
+        if ((left && Compare{}(*get_object(node), *get_object(left)))
+            || (right && Compare{}(*get_object(right), *get_object(node))))
+        {
+            return -1;
+        }
+
+        const Int32 leftHeight = validate_node(left, count);
+        const Int32 rightHeight = validate_node(right, count);
+        if (leftHeight < 0 || leftHeight != rightHeight)
+        {
+            return -1;
+        }
+        return leftHeight + (node->is_red() ? 0 : 1);
+    }
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Serrate/Memory/memory_utils.hpp"
+#include "Serrate/Memory/node_slab.hpp"
 
 
 template <Manual Type>
@@ -87,13 +88,13 @@ public:
     };
 
 private:
-    AllocatorInfo *allocatorInfo;
+    NodeSlab<Node> nodes;
     Node          *sentinel;
     USize          size;
 
 public:
     List() noexcept
-        : allocatorInfo(AllocatorInfo::get_default_allocator())
+        : nodes()
         , sentinel(nullptr)
         , size(0)
     {}
@@ -101,9 +102,9 @@ public:
     Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
     {
         assert(allocator && "Invalid pointer!");
-        allocatorInfo = allocator;
+        nodes.initialize(allocator);
 
-        sentinel = Memory::allocate<Node, false>(allocatorInfo);
+        sentinel = nodes.allocate_uninitialized();
 
         sentinel->next     = sentinel;
         sentinel->previous = sentinel;
@@ -115,14 +116,14 @@ public:
     {
         assert(allocator && "Invalid pointer!");
         assert(count > 0 && "Invalid initialization");
-        allocatorInfo = allocator;
+        nodes.initialize(allocator);
 
-        sentinel = Memory::allocate<Node, false>(allocatorInfo);
+        sentinel = nodes.allocate_uninitialized();
 
         Node *current = sentinel;
         for (USize i = 0; i < count; ++i)
         {
-            current->next = Memory::allocate<Node, false>(allocatorInfo);
+            current->next = nodes.allocate_uninitialized();
             current->next->previous = current;
             current = current->next;
 
@@ -141,7 +142,7 @@ public:
 
     Type &push_back(const Type &element) noexcept
     {
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Copyable<Type>)
         {
             target->data.copy(element);
@@ -162,7 +163,7 @@ public:
 
     Type &push_front(const Type &element) noexcept
     {
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Copyable<Type>)
         {
             target->data.copy(element);
@@ -184,7 +185,7 @@ public:
     Type &push(const Type &element, const USize frontIndex) noexcept
     {
         assert(frontIndex < size && "Index should fit in list range!");
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Copyable<Type>)
         {
             target->data.copy(element);
@@ -215,7 +216,7 @@ public:
 
     Type &push(const Type &element, Iterator &nextElement) noexcept
     {
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Copyable<Type>)
         {
             target->data.copy(element);
@@ -236,7 +237,7 @@ public:
 
     Type &emplace_back(Type &element) noexcept
     {
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Moveable<Type>)
         {
             target->data.move(element);
@@ -261,7 +262,7 @@ public:
 
     Type &emplace_front(Type &element) noexcept
     {
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Moveable<Type>)
         {
             target->data.move(element);
@@ -287,7 +288,7 @@ public:
     Type &emplace(const Type &element, const USize frontIndex) noexcept
     {
         assert(frontIndex < size && "Index should fit in list range!");
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Moveable<Type>)
         {
             target->data.move(element);
@@ -318,7 +319,7 @@ public:
 
     Type &emplace(const Type &element, Iterator &nextElement) noexcept
     {
-        Node *target = Memory::allocate<Node, false>(allocatorInfo);
+        Node *target = nodes.allocate_uninitialized();
         if constexpr (Moveable<Type>)
         {
             target->data.move(element);
@@ -363,7 +364,7 @@ public:
         {
             target->data.finalize();
         }
-        Memory::deallocate(allocatorInfo, target);
+        nodes.deallocate(target);
         return element;
     }
 
@@ -393,7 +394,7 @@ public:
         {
             target->data.finalize();
         }
-        Memory::deallocate(allocatorInfo, target);
+        nodes.deallocate(target);
         return element;
     }
 
@@ -429,7 +430,7 @@ public:
             {
                 current.get_node()->data.finalize();
             }
-            Memory::deallocate(allocatorInfo, current.get_node());
+            nodes.deallocate(current.get_node());
             break;
         }
 
@@ -458,7 +459,7 @@ public:
         {
             toPop.get_node()->data.finalize();
         }
-        Memory::deallocate(allocatorInfo, toPop.get_node());
+        nodes.deallocate(toPop.get_node());
         return element;
     }
 
@@ -481,7 +482,7 @@ public:
         {
             target->data.finalize();
         }
-        Memory::deallocate(allocatorInfo, target);
+        nodes.deallocate(target);
 
         return 1;
     }
@@ -504,7 +505,7 @@ public:
         {
             target->data.finalize();
         }
-        Memory::deallocate(allocatorInfo, target);
+        nodes.deallocate(target);
 
         return 1;
     }
@@ -532,7 +533,7 @@ public:
             {
                 current.get_node()->data.finalize();
             }
-            Memory::deallocate(allocatorInfo, current.get_node());
+            nodes.deallocate(current.get_node());
             break;
         }
 
@@ -554,7 +555,7 @@ public:
         {
             toDrop.get_node()->data.finalize();
         }
-        Memory::deallocate(allocatorInfo, toDrop.get_node());
+        nodes.deallocate(toDrop.get_node());
 
         return 1;
     }
@@ -568,8 +569,9 @@ public:
         }
 
         finalize();
-        allocatorInfo = source.allocatorInfo;
+        nodes         = source.nodes;
         sentinel      = source.sentinel;
+        size          = source.size;
 
         source = {};
     }
@@ -582,7 +584,7 @@ public:
         }
 
         finalize();
-        initialize(source.allocatorInfo);
+        initialize(source.nodes.get_allocator_info());
 
         for (const Type &element : source)
         {
@@ -701,7 +703,7 @@ public:
             }
             Node *toRemove = iterator.get_node();
             ++iterator;
-            Memory::deallocate(allocatorInfo, toRemove);
+            nodes.deallocate(toRemove);
         }
 
         sentinel->previous = sentinel;
@@ -711,7 +713,7 @@ public:
 
     Void finalize() noexcept
     {
-        assert(allocatorInfo && "Allocator is nullptr!");
+        assert(nodes.get_allocator_info() && "Allocator is nullptr!");
         if (!sentinel)
         {
             *this = {};
@@ -720,7 +722,7 @@ public:
 
         clear();
 
-        Memory::deallocate(allocatorInfo, sentinel);
+        nodes.finalize(); // Sentinel is released together with chunks
 
         *this = {};
     }
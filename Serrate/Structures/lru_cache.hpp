@@ -0,0 +1,403 @@
+#pragma once
+#include "hash_map.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+enum class ECachePolicy
+{
+    Lru,   // Every hit relinks entry to the front, evicts least recently used entry
+    Clock, // Hit only sets reference bit, hand sweeps entries and evicts first one without the bit
+};
+
+// Fixed capacity cache, all entries are allocated at once in initialize and recycled afterwards.
+// Entry holds hash chain and recency links itself, so lookup is a single probe and insert never allocates.
+// When cache is full, insert evicts one entry and passes it to eviction callback (if set) before reusing it.
+template <Hashable KeyType, Manual ValueType, ECachePolicy Policy = ECachePolicy::Lru>
+class LruCache
+{
+public:
+    using EvictionCallback = Void(*)(const KeyType &key, ValueType &value, Void *userData);
+
+private:
+    struct Node
+    {
+        Node *bucketNext;
+        Node *recencyNext;     // Towards less recently used, free list link for unused nodes
+        Node *recencyPrevious;
+        Bool isReferenced;
+        ValueType value;
+        KeyType key;
+
+        Node() noexcept
+        : bucketNext(nullptr)
+        , recencyNext(nullptr)
+        , recencyPrevious(nullptr)
+        , isReferenced(false)
+        , value(ValueType())
+        , key(KeyType())
+        {}
+    };
+
+    AllocatorInfo   *allocatorInfo;
+    Node            *nodes;     // Node capacity is the sentinel of recency list
+    Node           **buckets;
+    Node            *freeList;
+    EvictionCallback evictionCallback;
+    Void            *userData;
+    USize            capacity;
+    USize            bucketCount;
+    USize            size;
+    USize            hand;      // Next node examined by Clock policy
+
+public:
+    LruCache() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , nodes(nullptr)
+    , buckets(nullptr)
+    , freeList(nullptr)
+    , evictionCallback(nullptr)
+    , userData(nullptr)
+    , capacity(0)
+    , bucketCount(0)
+    , size(0)
+    , hand(0)
+    {}
+
+    Void initialize(const USize maxCount,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        assert(maxCount > 0 && "Capacity should be bigger than 0!");
+        allocatorInfo = allocator;
+        capacity = maxCount;
+        bucketCount = std::max(Memory::align_binary(maxCount), USize(2));
+        size = 0;
+        hand = 0;
+        evictionCallback = nullptr;
+        userData = nullptr;
+
+        nodes = Memory::allocate<Node>(allocatorInfo, capacity + 1);
+        buckets = Memory::allocate<Node *>(allocatorInfo, bucketCount);
+        reset_links();
+    }
+
+    // Callback is called only for entries pushed out by capacity, not for remove or clear
+    Void set_eviction_callback(const EvictionCallback callback, Void *callbackData = nullptr) noexcept
+    {
+        evictionCallback = callback;
+        userData = callbackData;
+    }
+
+    // Marks entry as used, returns nullptr when key is not cached
+    [[nodiscard]]
+    ValueType *get(const KeyType &key) noexcept
+    {
+        Node *node = find_node(key, hash_key(key));
+        if (!node)
+        {
+            return nullptr;
+        }
+
+        touch(node);
+        return &node->value;
+    }
+
+    // Does not change eviction order
+    [[nodiscard]]
+    const ValueType *peek(const KeyType &key) const noexcept
+    {
+        const Node *node = find_node(key, hash_key(key));
+        return node ? &node->value : nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return find_node(key, hash_key(key)) != nullptr;
+    }
+
+    // Overwrites value of cached key, otherwise inserts it and evicts an entry when cache is full
+    ValueType &put(const KeyType &key, const ValueType &value) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        Node *node = find_node(key, hash);
+        if (node)
+        {
+            touch(node);
+            if constexpr (Finalizable<ValueType>)
+            {
+                node->value.finalize();
+            }
+        } else {
+            node = link_new_node(hash);
+            if constexpr (Copyable<KeyType>)
+            {
+                node->key.copy(key);
+            } else {
+                node->key = key;
+            }
+        }
+
+        if constexpr (Copyable<ValueType>)
+        {
+            node->value.copy(value);
+        } else {
+            node->value = value;
+        }
+        return node->value;
+    }
+
+    ValueType &emplace(KeyType &key, ValueType &value) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        Node *node = find_node(key, hash);
+        if (node)
+        {
+            touch(node);
+            if constexpr (Finalizable<ValueType>)
+            {
+                node->value.finalize();
+            }
+        } else {
+            node = link_new_node(hash);
+            if constexpr (Moveable<KeyType>)
+            {
+                node->key.move(key);
+            }
+            else if constexpr (Copyable<KeyType>)
+            {
+                node->key.copy(key);
+            } else {
+                node->key = key;
+            }
+        }
+
+        if constexpr (Moveable<ValueType>)
+        {
+            node->value.move(value);
+        }
+        else if constexpr (Copyable<ValueType>)
+        {
+            node->value.copy(value);
+        } else {
+            node->value = value;
+        }
+        return node->value;
+    }
+
+    Bool remove(const KeyType &key) noexcept
+    {
+        const UInt64 hash = hash_key(key);
+        Node **link = buckets + (hash & (bucketCount - 1));
+        while (*link && !((*link)->key == key))
+        {
+            link = &(*link)->bucketNext;
+        }
+
+        Node *node = *link;
+        if (!node)
+        {
+            return false;
+        }
+
+        *link = node->bucketNext;
+        if constexpr (Policy == ECachePolicy::Lru)
+        {
+            unlink_recency(node);
+        }
+        release(node);
+        return true;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    [[nodiscard]]
+    Bool is_full() const noexcept
+    {
+        return size == capacity;
+    }
+
+    Void clear() noexcept
+    {
+        for (USize i = 0; i < bucketCount; ++i)
+        {
+            for (Node *current = buckets[i]; current;)
+            {
+                Node *toClear = current;
+                current = current->bucketNext;
+                finalize_entry(toClear);
+            }
+        }
+
+        reset_links();
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if (nodes)
+        {
+            clear();
+            Memory::deallocate(allocatorInfo, nodes);
+            Memory::deallocate(allocatorInfo, buckets);
+        }
+
+        *this = {};
+    }
+
+private:
+    [[nodiscard]]
+    Node *find_node(const KeyType &key, const UInt64 hash) const noexcept
+    {
+        Node *current = buckets[hash & (bucketCount - 1)];
+        while (current && !(current->key == key))
+        {
+            current = current->bucketNext;
+        }
+        return current;
+    }
+
+    Void touch(Node *node) noexcept
+    {
+        if constexpr (Policy == ECachePolicy::Lru)
+        {
+            unlink_recency(node);
+            link_front(node);
+        } else {
+            node->isReferenced = true;
+        }
+    }
+
+    Node *link_new_node(const UInt64 hash) noexcept
+    {
+        Node *node;
+        if (freeList)
+        {
+            node = freeList;
+            freeList = freeList->recencyNext;
+        } else {
+            node = evict();
+        }
+
+        Node **bucket = buckets + (hash & (bucketCount - 1));
+        node->bucketNext = *bucket;
+        *bucket = node;
+        node->isReferenced = false;
+        if constexpr (Policy == ECachePolicy::Lru)
+        {
+            link_front(node);
+        }
+
+        ++size;
+        return node;
+    }
+
+    // Only called when every node is in use, so Clock hand sweeps node array directly
+    Node *evict() noexcept
+    {
+        Node *victim;
+        if constexpr (Policy == ECachePolicy::Lru)
+        {
+            victim = nodes[capacity].recencyPrevious;
+            unlink_recency(victim);
+        } else {
+            while (nodes[hand].isReferenced)
+            {
+                nodes[hand].isReferenced = false;
+                hand = hand + 1 == capacity ? 0 : hand + 1;
+            }
+            victim = nodes + hand;
+            hand = hand + 1 == capacity ? 0 : hand + 1;
+        }
+
+        Node **link = buckets + (hash_key(victim->key) & (bucketCount - 1));
+        while (*link != victim)
+        {
+            link = &(*link)->bucketNext;
+        }
+        *link = victim->bucketNext;
+
+        if (evictionCallback)
+        {
+            evictionCallback(victim->key, victim->value, userData);
+        }
+        finalize_entry(victim);
+        --size;
+        return victim;
+    }
+
+    Void link_front(Node *node) noexcept
+    {
+        Node *sentinel = nodes + capacity;
+        node->recencyPrevious = sentinel;
+        node->recencyNext = sentinel->recencyNext;
+        sentinel->recencyNext->recencyPrevious = node;
+        sentinel->recencyNext = node;
+    }
+
+    static Void unlink_recency(Node *node) noexcept
+    {
+        node->recencyPrevious->recencyNext = node->recencyNext;
+        node->recencyNext->recencyPrevious = node->recencyPrevious;
+    }
+
+    Void release(Node *node) noexcept
+    {
+        finalize_entry(node);
+        node->recencyNext = freeList;
+        freeList = node;
+        --size;
+    }
+
+    static Void finalize_entry(Node *node) noexcept
+    {
+        if constexpr (Finalizable<KeyType>)
+        {
+            node->key.finalize();
+        }
+        if constexpr (Finalizable<ValueType>)
+        {
+            node->value.finalize();
+        }
+        node->key = KeyType();
+        node->value = ValueType();
+    }
+
+    // Puts every node on free list in array order and empties buckets and recency list
+    Void reset_links() noexcept
+    {
+        for (USize i = 0; i < bucketCount; ++i)
+        {
+            buckets[i] = nullptr;
+        }
+
+        freeList = nullptr;
+        for (USize i = capacity; i > 0; --i)
+        {
+            nodes[i - 1].recencyNext = freeList;
+            freeList = nodes + i - 1;
+        }
+
+        Node *sentinel = nodes + capacity;
+        sentinel->recencyNext = sentinel;
+        sentinel->recencyPrevious = sentinel;
+        size = 0;
+        hand = 0;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,234 @@
+#pragma once
+#include "string.hpp"
+#include "string_view.hpp"
+#include "hash_map.hpp"
+#include "Serrate/Memory/mapped_file.hpp"
+
+#include <cstring>
+
+// Read only string keyed hash table served straight from mapped file, nothing is deserialized on load.
+// File is written once by write() from HashMap<String, ValueType>, layout is:
+// Header | Slot[slotCount] | key arena
+// Slots use open addressing with linear probing and keep at most half of them used, keys are referenced
+// by offsets into arena so the same file works at any mapping address and pages are shared between processes.
+// Values are copied bytewise, so they must not contain pointers.
+template <Manual ValueType>
+class MappedHashMap
+{
+private:
+    static constexpr UInt64 MAGIC   = 0x50414D4853524553; // "SERSHMAP"
+    static constexpr UInt32 VERSION = 1;
+
+    struct Header
+    {
+        UInt64 magic;
+        UInt32 version;
+        UInt32 valueSize;
+        UInt64 slotCount;
+        UInt64 entryCount;
+        UInt64 slotsOffset;
+        UInt64 arenaOffset;
+        UInt64 arenaSize;
+    };
+
+    struct Slot
+    {
+        UInt64    hash;
+        UInt64    keyOffset;
+        UInt32    keySize;
+        UInt32    isUsed;
+        ValueType value;
+    };
+
+    MappedFile  file;
+    const Slot *slots;
+    const Char *arena;
+    USize       arenaSize;
+    USize       slotMask;
+    USize       size;
+
+public:
+    MappedHashMap() noexcept
+    : file()
+    , slots(nullptr)
+    , arena(nullptr)
+    , arenaSize(0)
+    , slotMask(0)
+    , size(0)
+    {}
+
+    // Maps file and validates its header, returns false when file is missing or was not written by
+    // write() for the same ValueType size
+    [[nodiscard]]
+    Bool initialize(const Char *path) noexcept
+    {
+        if (!file.initialize(path))
+        {
+            return false;
+        }
+
+        const Byte *data = file.get_data();
+        const USize bytes = file.get_size();
+        if (bytes < sizeof(Header))
+        {
+            finalize();
+            return false;
+        }
+
+        // Offsets and sizes come from file, so every bound is checked by subtraction from mapped size
+        // and sums are formed only after their parts are known to fit, corrupt header can not wrap around
+        Header header;
+        std::memcpy(&header, data, sizeof(Header));
+        const Bool isValid = header.magic == MAGIC
+                          && header.version == VERSION
+                          && header.valueSize == sizeof(ValueType)
+                          && header.slotCount != 0
+                          && std::has_single_bit(header.slotCount)
+                          && header.entryCount < header.slotCount
+                          && header.slotsOffset >= sizeof(Header)
+                          && header.slotsOffset % alignof(Slot) == 0
+                          && header.slotsOffset <= bytes
+                          && header.slotCount <= (bytes - header.slotsOffset) / sizeof(Slot)
+                          && header.slotsOffset + header.slotCount * sizeof(Slot) <= header.arenaOffset
+                          && header.arenaOffset <= bytes
+                          && header.arenaSize <= bytes - header.arenaOffset;
+        if (!isValid)
+        {
+            finalize();
+            return false;
+        }
+
+        slots     = reinterpret_cast<const Slot *>(data + header.slotsOffset);
+        arena     = reinterpret_cast<const Char *>(data + header.arenaOffset);
+        arenaSize = USize(header.arenaSize);
+        slotMask  = USize(header.slotCount - 1);
+        size      = USize(header.entryCount);
+        return true;
+    }
+
+    // Serializes source into file at path, existing file is replaced
+    [[nodiscard]]
+    static Bool write(const Char *path, const HashMap<String, ValueType> &source,
+                      AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(path && "Invalid pointer!");
+        assert(allocator && "Allocator is nullptr!");
+
+        const USize entryCount = source.get_size();
+        const USize slotCount = std::bit_ceil(std::max(entryCount * 2, USize(2)));
+
+        USize arenaSize = 0;
+        for (auto iterator = source.begin(); iterator != source.end(); ++iterator)
+        {
+            arenaSize += iterator.get_node()->key.get_size();
+        }
+
+        const USize slotsOffset = Memory::align_offset(sizeof(Header), Memory::CACHE_LINE_SIZE);
+        const USize arenaOffset = slotsOffset + slotCount * sizeof(Slot);
+        const USize bytes = arenaOffset + arenaSize;
+
+        Byte *image = allocator->allocate(allocator->allocator, bytes, Memory::CACHE_LINE_SIZE);
+        assert(image && "Allocation failed!");
+        std::memset(image, 0, bytes);
+
+        const Header header = {
+            .magic       = MAGIC,
+            .version     = VERSION,
+            .valueSize   = UInt32(sizeof(ValueType)),
+            .slotCount   = slotCount,
+            .entryCount  = entryCount,
+            .slotsOffset = slotsOffset,
+            .arenaOffset = arenaOffset,
+            .arenaSize   = arenaSize
+        };
+        std::memcpy(image, &header, sizeof(Header));
+
+        Slot *targetSlots = reinterpret_cast<Slot *>(image + slotsOffset);
+        Char *targetArena = reinterpret_cast<Char *>(image + arenaOffset);
+        USize keyOffset = 0;
+        for (auto iterator = source.begin(); iterator != source.end(); ++iterator)
+        {
+            const auto *node = iterator.get_node();
+            const USize keySize = node->key.get_size();
+            const UInt64 hash = node->key.hash();
+
+            USize index = USize(hash) & (slotCount - 1);
+            while (targetSlots[index].isUsed)
+            {
+                index = (index + 1) & (slotCount - 1);
+            }
+
+            Slot &slot = targetSlots[index];
+            slot.hash      = hash;
+            slot.keyOffset = keyOffset;
+            slot.keySize   = UInt32(keySize);
+            slot.isUsed    = 1;
+            slot.value     = node->value;
+
+            std::memcpy(targetArena + keyOffset, node->key.get_data(), keySize);
+            keyOffset += keySize;
+        }
+
+        const Bool isWritten = MappedFile::write(path, image, bytes);
+        allocator->deallocate(allocator->allocator, image);
+        return isWritten;
+    }
+
+    [[nodiscard]]
+    const ValueType *find(const StringView &key) const noexcept
+    {
+        if (!slots)
+        {
+            return nullptr;
+        }
+
+        const UInt64 hash = key.hash();
+        const USize keySize = key.get_size();
+        // Probing stops after one lap and key ranges are checked against arena, so slots of damaged
+        // file can not loop forever or read past mapping
+        USize index = USize(hash) & slotMask;
+        for (USize probe = 0; probe <= slotMask && slots[index].isUsed; ++probe, index = (index + 1) & slotMask)
+        {
+            const Slot &slot = slots[index];
+            if (slot.hash == hash && slot.keySize == keySize
+                && keySize <= arenaSize && slot.keyOffset <= arenaSize - keySize
+                && std::memcmp(arena + slot.keyOffset, key.get_data(), keySize) == 0)
+            {
+                return &slot.value;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]]
+    Bool contains(const StringView &key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    [[nodiscard]]
+    const ValueType &operator[](const StringView &key) const noexcept
+    {
+        const ValueType *value = find(key);
+        assert(value && "Key not found!");
+        return *value;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Void finalize() noexcept
+    {
+        file.finalize();
+        *this = {};
+    }
+};
\ No newline at end of file
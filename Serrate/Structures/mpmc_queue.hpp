@@ -0,0 +1,306 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <new>
+#include <thread>
+
+// Bounded queue for any number of producer and consumer threads (Vyukov). Every slot carries sequence
+// number telling which lap of the ring it waits for, so producers and consumers claim slots with single
+// compare and swap on their own position and never wait for each other unless queue is full or empty.
+// Values are stored inline in slots. Blocking push and pop spin, then yield and finally park on epoch
+// counter, parked threads are woken by opposite side only when someone is parked.
+// initialize and finalize are not thread safe.
+template <Manual Type>
+class MPMCQueue
+{
+private:
+    static constexpr USize SPIN_COUNT  = 64;
+    static constexpr USize YIELD_COUNT = 16;
+
+    struct Cell
+    {
+        std::atomic<USize> sequence;
+        Type               value;
+    };
+
+    alignas(Memory::CACHE_LINE_SIZE) std::atomic<USize> enqueuePosition;
+    alignas(Memory::CACHE_LINE_SIZE) std::atomic<USize> dequeuePosition;
+
+    // Bumped after push or pop only when some thread of other side is parked
+    alignas(Memory::CACHE_LINE_SIZE) std::atomic<UInt32> pushEpoch;
+    std::atomic<UInt32> parkedConsumers;
+    alignas(Memory::CACHE_LINE_SIZE) std::atomic<UInt32> popEpoch;
+    std::atomic<UInt32> parkedProducers;
+
+    alignas(Memory::CACHE_LINE_SIZE) AllocatorInfo *allocatorInfo;
+    Cell *cells;
+    USize capacity;
+
+public:
+    MPMCQueue() noexcept
+    : enqueuePosition(0)
+    , dequeuePosition(0)
+    , pushEpoch(0)
+    , parkedConsumers(0)
+    , popEpoch(0)
+    , parkedProducers(0)
+    , allocatorInfo(AllocatorInfo::get_default_allocator())
+    , cells(nullptr)
+    , capacity(0)
+    {}
+
+    // Capacity is rounded up to power of two
+    Void initialize(const USize initialCapacity, AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        capacity = std::bit_ceil(std::max(initialCapacity, USize(2)));
+
+        Byte *memory = allocatorInfo->allocate(allocatorInfo->allocator, capacity * sizeof(Cell),
+                                               std::max(alignof(Cell), Memory::CACHE_LINE_SIZE));
+        assert(memory && "Failed to allocate cells!");
+        cells = reinterpret_cast<Cell *>(memory);
+        for (USize i = 0; i < capacity; ++i)
+        {
+            new (cells + i) Cell{};
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        cells = std::launder(cells);
+
+        enqueuePosition.store(0, std::memory_order_relaxed);
+        dequeuePosition.store(0, std::memory_order_relaxed);
+    }
+
+    Bool try_push(const Type &element) noexcept
+    {
+        Cell *cell = claim_for_push();
+        if (!cell)
+        {
+            return false;
+        }
+
+        if constexpr (Copyable<Type>)
+        {
+            cell->value.copy(element);
+        } else {
+            cell->value = element;
+        }
+        publish_push(cell);
+        return true;
+    }
+
+    // Element is left empty on success
+    Bool try_emplace(Type &element) noexcept
+    {
+        Cell *cell = claim_for_push();
+        if (!cell)
+        {
+            return false;
+        }
+
+        take(cell->value, element);
+        publish_push(cell);
+        return true;
+    }
+
+    // Popped element is moved into element same way as move() does
+    Bool try_pop(Type &element) noexcept
+    {
+        USize position = dequeuePosition.load(std::memory_order_relaxed);
+        Cell *cell = nullptr;
+        while (true)
+        {
+            cell = &cells[position & (capacity - 1)];
+            const USize sequence = cell->sequence.load(std::memory_order_acquire);
+            const SSize difference = SSize(sequence) - SSize(position + 1);
+            if (difference == 0)
+            {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            } else {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        take(element, cell->value);
+        cell->sequence.store(position + capacity, std::memory_order_release);
+        wake(popEpoch, parkedProducers);
+        return true;
+    }
+
+    // Waits while queue is full
+    Void push(const Type &element) noexcept
+    {
+        wait_until([&]() { return try_push(element); }, popEpoch, parkedProducers);
+    }
+
+    Void emplace(Type &element) noexcept
+    {
+        wait_until([&]() { return try_emplace(element); }, popEpoch, parkedProducers);
+    }
+
+    // Waits while queue is empty
+    Void pop(Type &element) noexcept
+    {
+        wait_until([&]() { return try_pop(element); }, pushEpoch, parkedConsumers);
+    }
+
+    // Only approximate while other threads push or pop
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        const USize tail = enqueuePosition.load(std::memory_order_acquire);
+        const USize head = dequeuePosition.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return get_size() == 0;
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    // Finalizes elements left in queue
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if (cells)
+        {
+            if constexpr (Finalizable<Type>)
+            {
+                const USize end = enqueuePosition.load(std::memory_order_acquire);
+                for (USize position = dequeuePosition.load(std::memory_order_acquire); position != end; ++position)
+                {
+                    cells[position & (capacity - 1)].value.finalize();
+                }
+            }
+
+            for (USize i = 0; i < capacity; ++i)
+            {
+                cells[i].~Cell();
+            }
+            allocatorInfo->deallocate(allocatorInfo->allocator, byte_cast(cells));
+        }
+
+        allocatorInfo = AllocatorInfo::get_default_allocator();
+        cells = nullptr;
+        capacity = 0;
+        enqueuePosition.store(0, std::memory_order_relaxed);
+        dequeuePosition.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    // Returns slot owned by caller or nullptr when queue is full
+    Cell *claim_for_push() noexcept
+    {
+        USize position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell *cell = &cells[position & (capacity - 1)];
+            const USize sequence = cell->sequence.load(std::memory_order_acquire);
+            const SSize difference = SSize(sequence) - SSize(position);
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    return cell;
+                }
+            }
+            else if (difference < 0)
+            {
+                return nullptr;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    Void publish_push(Cell *cell) noexcept
+    {
+        const USize position = cell->sequence.load(std::memory_order_relaxed);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        wake(pushEpoch, parkedConsumers);
+    }
+
+    // Fence pairs with one in wait_until, so either parked thread sees published slot or this thread sees
+    // parked counter
+    static Void wake(std::atomic<UInt32> &epoch, std::atomic<UInt32> &parked) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked.load(std::memory_order_relaxed) > 0)
+        {
+            epoch.fetch_add(1, std::memory_order_release);
+            epoch.notify_all();
+        }
+    }
+
+    template <typename Function>
+    static Void wait_until(Function &&attempt, std::atomic<UInt32> &epoch, std::atomic<UInt32> &parked) noexcept
+    {
+        for (USize i = 0; i < SPIN_COUNT; ++i)
+        {
+            if (attempt())
+            {
+                return;
+            }
+        }
+
+        for (USize i = 0; i < YIELD_COUNT; ++i)
+        {
+            if (attempt())
+            {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        while (true)
+        {
+            parked.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const UInt32 observed = epoch.load(std::memory_order_acquire);
+            if (attempt())
+            {
+                parked.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+            epoch.wait(observed, std::memory_order_acquire);
+            parked.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Source is left empty, so slot can be reused without finalize
+    static Void take(Type &target, Type &source) noexcept
+    {
+        if constexpr (Moveable<Type>)
+        {
+            target.move(source);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(source);
+            if constexpr (Finalizable<Type>)
+            {
+                source.finalize();
+            }
+        } else {
+            target = source;
+        }
+    }
+};
\ No newline at end of file
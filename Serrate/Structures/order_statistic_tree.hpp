@@ -0,0 +1,331 @@
+#pragma once
+#include "intrusive_rb_tree.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+#include "Serrate/Memory/node_slab.hpp"
+
+#include <type_traits>
+
+// Sorted multiset of keys where every node knows size of its subtree, so select (k-th key) and rank
+// (count of smaller keys) take O(log n). When SumType is not Void, nodes also keep subtree sum of keys
+// converted to SumType, which gives range sums in O(log n).
+template <Ordered KeyType, typename SumType = Void>
+requires Manual<KeyType> && std::is_standard_layout_v<KeyType>
+class OrderStatisticTree
+{
+private:
+    static constexpr Bool HAS_SUMS = !std::is_void_v<SumType>;
+
+    struct NoSum {};
+    using SumStorage = std::conditional_t<HAS_SUMS, SumType, NoSum>;
+
+    struct Node
+    {
+        KeyType key;
+        RBHook  hook;
+        USize   count;
+        [[no_unique_address]] SumStorage sum;
+    };
+
+    struct KeyLess
+    {
+        Bool operator()(const Node &left, const Node &right) const noexcept
+        {
+            return left.key < right.key;
+        }
+
+        Bool operator()(const Node &left, const KeyType &right) const noexcept
+        {
+            return left.key < right;
+        }
+
+        Bool operator()(const KeyType &left, const Node &right) const noexcept
+        {
+            return left < right.key;
+        }
+    };
+
+    struct SubtreeAugment
+    {
+        static Void update(Node &node, const Node *left, const Node *right) noexcept
+        {
+            node.count = 1 + (left ? left->count : 0) + (right ? right->count : 0);
+            if constexpr (HAS_SUMS)
+            {
+                node.sum = SumType(node.key);
+                if (left)
+                {
+                    node.sum += left->sum;
+                }
+                if (right)
+                {
+                    node.sum += right->sum;
+                }
+            }
+        }
+    };
+
+    using Tree = IntrusiveRBTree<Node, offsetof(Node, hook), KeyLess, SubtreeAugment>;
+
+public:
+    struct Iterator
+    {
+    private:
+        typename Tree::Iterator iterator;
+
+    public:
+        Iterator() noexcept
+        : iterator()
+        {}
+
+        Iterator(const typename Tree::Iterator &initialIterator) noexcept
+        : iterator(initialIterator)
+        {}
+
+        const KeyType &operator*() const noexcept
+        {
+            return iterator->key;
+        }
+
+        const KeyType *operator->() const noexcept
+        {
+            return &iterator->key;
+        }
+
+        Void operator++() noexcept
+        {
+            ++iterator;
+        }
+
+        Void operator--() noexcept
+        {
+            --iterator;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return iterator == other.iterator;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return iterator != other.iterator;
+        }
+    };
+
+private:
+    NodeSlab<Node> nodes;
+    Tree           tree;
+
+public:
+    OrderStatisticTree() noexcept
+    : nodes()
+    , tree()
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        nodes.initialize(allocator);
+        tree = {};
+    }
+
+    // Equal keys are kept, every insert adds one occurrence
+    Void insert(const KeyType &key) noexcept
+    {
+        Node *node = nodes.allocate();
+        if constexpr (Copyable<KeyType>)
+        {
+            node->key.copy(key);
+        } else {
+            node->key = key;
+        }
+        tree.insert(*node);
+    }
+
+    // Removes one occurrence of key
+    Bool remove(const KeyType &key) noexcept
+    {
+        Node *node = tree.find(key);
+        if (!node)
+        {
+            return false;
+        }
+
+        tree.remove(*node);
+        if constexpr (Finalizable<KeyType>)
+        {
+            node->key.finalize();
+        }
+        nodes.deallocate(node);
+        return true;
+    }
+
+    [[nodiscard]]
+    Bool contains(const KeyType &key) const noexcept
+    {
+        return tree.find(key) != nullptr;
+    }
+
+    // Key at position index in sorted order, index 0 is the smallest key
+    [[nodiscard]]
+    const KeyType &select(USize index) const noexcept
+    {
+        assert(index < get_size() && "Index out of bounds!");
+        const Node *node = tree.get_root();
+        while (true)
+        {
+            const USize leftCount = get_count(Tree::get_left(*node));
+            if (index < leftCount)
+            {
+                node = Tree::get_left(*node);
+            }
+            else if (index == leftCount)
+            {
+                return node->key;
+            } else {
+                index -= leftCount + 1;
+                node = Tree::get_right(*node);
+            }
+        }
+    }
+
+    // Key below which lies given fraction of keys, fraction is in range [0, 1]
+    [[nodiscard]]
+    const KeyType &select_fraction(const Float64 fraction) const noexcept
+    {
+        assert(fraction >= 0.0 && fraction <= 1.0 && "Fraction should be in [0, 1]!");
+        const USize index = USize(fraction * Float64(get_size() - 1) + 0.5);
+        return select(index);
+    }
+
+    // Number of keys less than given one
+    [[nodiscard]]
+    USize rank(const KeyType &key) const noexcept
+    {
+        USize result = 0;
+        for (const Node *node = tree.get_root(); node;)
+        {
+            if (node->key < key)
+            {
+                result += get_count(Tree::get_left(*node)) + 1;
+                node = Tree::get_right(*node);
+            } else {
+                node = Tree::get_left(*node);
+            }
+        }
+        return result;
+    }
+
+    // Number of keys in range [low, high)
+    [[nodiscard]]
+    USize count_range(const KeyType &low, const KeyType &high) const noexcept
+    {
+        if (!(low < high))
+        {
+            return 0;
+        }
+        return rank(high) - rank(low);
+    }
+
+    // Sum of keys less than given one
+    [[nodiscard]]
+    SumType sum_less(const KeyType &key) const noexcept
+    requires HAS_SUMS
+    {
+        SumType result = SumType();
+        for (const Node *node = tree.get_root(); node;)
+        {
+            if (node->key < key)
+            {
+                if (const Node *left = Tree::get_left(*node))
+                {
+                    result += left->sum;
+                }
+                result += SumType(node->key);
+                node = Tree::get_right(*node);
+            } else {
+                node = Tree::get_left(*node);
+            }
+        }
+        return result;
+    }
+
+    // Sum of keys in range [low, high)
+    [[nodiscard]]
+    SumType sum_range(const KeyType &low, const KeyType &high) const noexcept
+    requires HAS_SUMS
+    {
+        if (!(low < high))
+        {
+            return SumType();
+        }
+        return sum_less(high) - sum_less(low);
+    }
+
+    [[nodiscard]]
+    SumType get_sum() const noexcept
+    requires HAS_SUMS
+    {
+        const Node *root = tree.get_root();
+        return root ? root->sum : SumType();
+    }
+
+    [[nodiscard]]
+    Iterator begin() const noexcept
+    {
+        return Iterator{ tree.begin() };
+    }
+
+    [[nodiscard]]
+    Iterator end() const noexcept
+    {
+        return Iterator{ tree.end() };
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return tree.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return tree.is_empty();
+    }
+
+    Void clear() noexcept
+    {
+        finalize_keys();
+        AllocatorInfo *allocator = nodes.get_allocator_info();
+        nodes.finalize();
+        nodes.initialize(allocator);
+        tree.clear();
+    }
+
+    Void finalize() noexcept
+    {
+        finalize_keys();
+        nodes.finalize();
+        *this = {};
+    }
+
+private:
+    // Nodes are released together with slab, only keys owning memory need to be visited
+    Void finalize_keys() noexcept
+    {
+        if constexpr (Finalizable<KeyType>)
+        {
+            for (auto iterator = tree.begin(); iterator != tree.end(); ++iterator)
+            {
+                iterator->key.finalize();
+            }
+        }
+    }
+
+    [[nodiscard]]
+    static USize get_count(const Node *node) noexcept
+    {
+        return node ? node->count : 0;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,517 @@
+#pragma once
+#include "dynamic_array.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Utilities/sort.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+// Heap with Arity children per node stored in DynamicArray. With 4 children tree is half as deep as binary
+// heap and all children of node usually share one cache line, so pop does fewer dependent loads. Top is
+// element ordered first by Compare, with default Sort::Less it is the smallest one. Compare has to be
+// default constructible. Sifting moves one hole instead of swapping, so every level costs single move.
+template <Manual Type, typename Compare = Sort::Less, USize Arity = 4>
+requires (Arity >= 2)
+class PriorityQueue
+{
+private:
+    DynamicArray<Type> elements;
+
+public:
+    PriorityQueue() noexcept
+    : elements()
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        elements.initialize(allocator);
+    }
+
+    Void initialize(const USize initialCapacity, AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        elements.initialize(initialCapacity, allocator);
+    }
+
+    // Takes elements of source and orders them in O(n), source is left empty
+    Void initialize(DynamicArray<Type> &source) noexcept
+    {
+        elements.move(source);
+        heapify();
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        elements.reserve(newCapacity);
+    }
+
+    Void push(const Type &element) noexcept
+    {
+        elements.push_back(element);
+        sift_up(elements.get_size() - 1);
+    }
+
+    Void emplace(Type &element) noexcept
+    {
+        elements.emplace_back(element);
+        sift_up(elements.get_size() - 1);
+    }
+
+    // Big batches rebuild whole heap in O(n + count) instead of sifting every element
+    Void push_range(const Type *source, const USize count) noexcept
+    {
+        const USize oldSize = elements.get_size();
+        elements.reserve(oldSize + count);
+        for (USize i = 0; i < count; ++i)
+        {
+            elements.push_back(source[i]);
+        }
+
+        if (count > oldSize / 2)
+        {
+            heapify();
+        } else {
+            for (USize i = oldSize; i < oldSize + count; ++i)
+            {
+                sift_up(i);
+            }
+        }
+    }
+
+    [[nodiscard]]
+    const Type &get_top() const noexcept
+    {
+        assert(!elements.is_empty() && "Queue is empty!");
+        return elements[0];
+    }
+
+    Void remove_top() noexcept
+    {
+        assert(!elements.is_empty() && "Queue is empty!");
+        Type last = elements.pop_back();
+        if (elements.is_empty())
+        {
+            if constexpr (Finalizable<Type>)
+            {
+                last.finalize();
+            }
+            return;
+        }
+
+        if constexpr (Finalizable<Type>)
+        {
+            elements[0].finalize();
+        }
+        sift_down(0, last);
+    }
+
+    [[nodiscard("Use remove_top")]]
+    Type pop_top() noexcept
+    {
+        assert(!elements.is_empty() && "Queue is empty!");
+        Type last = elements.pop_back();
+        if (elements.is_empty())
+        {
+            return last;
+        }
+
+        Type top{};
+        Sort::Detail::relocate(top, elements[0]);
+        sift_down(0, last);
+        return top;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return elements.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return elements.is_empty();
+    }
+
+    // Elements in heap order, only first one is guaranteed to be top
+    [[nodiscard]]
+    const Type *get_data() const noexcept
+    {
+        return elements.get_data();
+    }
+
+    Void clear() noexcept
+    {
+        elements.clear();
+    }
+
+    Void copy(const PriorityQueue &source) noexcept
+    {
+        assert(&source != this && "Tried to copy priority queue into itself!");
+        elements.copy(source.elements);
+    }
+
+    Void move(PriorityQueue &source) noexcept
+    {
+        assert(&source != this && "Tried to move priority queue into itself!");
+        elements.move(source.elements);
+    }
+
+    Void finalize() noexcept
+    {
+        elements.finalize();
+    }
+
+private:
+    Void heapify() noexcept
+    {
+        const USize size = elements.get_size();
+        if (size < 2)
+        {
+            return;
+        }
+
+        for (USize index = (size - 2) / Arity + 1; index-- > 0;)
+        {
+            Type value{};
+            Sort::Detail::relocate(value, elements[index]);
+            sift_down(index, value);
+        }
+    }
+
+    Void sift_up(USize index) noexcept
+    {
+        Type value{};
+        Sort::Detail::relocate(value, elements[index]);
+        while (index > 0)
+        {
+            const USize parent = (index - 1) / Arity;
+            if (!Compare{}(value, elements[parent]))
+            {
+                break;
+            }
+            Sort::Detail::relocate(elements[index], elements[parent]);
+            index = parent;
+        }
+        Sort::Detail::relocate(elements[index], value);
+    }
+
+    // Moves hole at index down until value fits into it
+    Void sift_down(USize index, Type &value) noexcept
+    {
+        const USize size = elements.get_size();
+        while (true)
+        {
+            const USize firstChild = index * Arity + 1;
+            if (firstChild >= size)
+            {
+                break;
+            }
+
+            USize best = firstChild;
+            const USize lastChild = std::min(firstChild + Arity, size);
+            for (USize child = firstChild + 1; child < lastChild; ++child)
+            {
+                best = Compare{}(elements[child], elements[best]) ? child : best;
+            }
+
+            if (!Compare{}(elements[best], value))
+            {
+                break;
+            }
+            Sort::Detail::relocate(elements[index], elements[best]);
+            index = best;
+        }
+        Sort::Detail::relocate(elements[index], value);
+    }
+};
+
+// Priority queue where pushed values get stable handle, so value can later be changed or removed in
+// O(log n) (scheduler timers, Dijkstra). Values never move, heap orders only handles and every handle
+// knows its heap position. Handles of removed values are reused by later pushes.
+template <Manual Type, typename Compare = Sort::Less, USize Arity = 4>
+requires (Arity >= 2)
+class IndexedPriorityQueue
+{
+public:
+    using Handle = USize;
+    static constexpr Handle INVALID_HANDLE = ~USize(0);
+
+private:
+    DynamicArray<Handle> heap;
+    DynamicArray<USize>  positions; // Heap position of every handle, INVALID_HANDLE when free
+    DynamicArray<Type>   values;
+    DynamicArray<Handle> freeHandles;
+
+public:
+    IndexedPriorityQueue() noexcept
+    : heap()
+    , positions()
+    , values()
+    , freeHandles()
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        heap.initialize(allocator);
+        positions.initialize(allocator);
+        values.initialize(allocator);
+        freeHandles.initialize(allocator);
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        heap.reserve(newCapacity);
+        positions.reserve(newCapacity);
+        values.reserve(newCapacity);
+    }
+
+    Handle push(const Type &value) noexcept
+    {
+        const Handle handle = get_free_handle();
+        if constexpr (Copyable<Type>)
+        {
+            values[handle].copy(value);
+        } else {
+            values[handle] = value;
+        }
+        insert_handle(handle);
+        return handle;
+    }
+
+    Handle emplace(Type &value) noexcept
+    {
+        const Handle handle = get_free_handle();
+        if constexpr (Moveable<Type>)
+        {
+            values[handle].move(value);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            values[handle].copy(value);
+        } else {
+            values[handle] = value;
+        }
+        insert_handle(handle);
+        return handle;
+    }
+
+    [[nodiscard]]
+    Bool contains(const Handle handle) const noexcept
+    {
+        return handle < positions.get_size() && positions[handle] != INVALID_HANDLE;
+    }
+
+    [[nodiscard]]
+    const Type &get(const Handle handle) const noexcept
+    {
+        assert(contains(handle) && "Handle is not in queue!");
+        return values[handle];
+    }
+
+    [[nodiscard]]
+    Handle get_top_handle() const noexcept
+    {
+        assert(!heap.is_empty() && "Queue is empty!");
+        return heap[0];
+    }
+
+    [[nodiscard]]
+    const Type &get_top() const noexcept
+    {
+        return values[get_top_handle()];
+    }
+
+    // New value can not be ordered after current one, only moves handle towards top
+    Void decrease_key(const Handle handle, const Type &value) noexcept
+    {
+        assert(contains(handle) && "Handle is not in queue!");
+        assert(!Compare{}(values[handle], value) && "New value is ordered after current one!");
+        assign(handle, value);
+        sift_up(positions[handle]);
+    }
+
+    // Any new value, handle moves up or down
+    Void update(const Handle handle, const Type &value) noexcept
+    {
+        assert(contains(handle) && "Handle is not in queue!");
+        assign(handle, value);
+        const USize position = positions[handle];
+        sift_up(position);
+        if (heap[position] == handle)
+        {
+            sift_down(position);
+        }
+    }
+
+    Void remove(const Handle handle) noexcept
+    {
+        assert(contains(handle) && "Handle is not in queue!");
+        const USize position = positions[handle];
+        const Handle last = heap.pop_back();
+        release_handle(handle);
+        if (last == handle)
+        {
+            return;
+        }
+
+        place(position, last);
+        sift_up(position);
+        if (heap[position] == last)
+        {
+            sift_down(position);
+        }
+    }
+
+    Void remove_top() noexcept
+    {
+        remove(get_top_handle());
+    }
+
+    [[nodiscard("Use remove_top")]]
+    Type pop_top() noexcept
+    {
+        const Handle handle = get_top_handle();
+        Type top{};
+        Sort::Detail::relocate(top, values[handle]);
+        Memory::start_object<Type>(byte_cast(&values[handle]));
+        remove(handle);
+        return top;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return heap.get_size();
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return heap.is_empty();
+    }
+
+    // Invalidates all handles
+    Void clear() noexcept
+    {
+        heap.clear();
+        positions.clear();
+        values.clear();
+        freeHandles.clear();
+    }
+
+    Void copy(const IndexedPriorityQueue &source) noexcept
+    {
+        assert(&source != this && "Tried to copy priority queue into itself!");
+        heap.copy(source.heap);
+        positions.copy(source.positions);
+        values.copy(source.values);
+        freeHandles.copy(source.freeHandles);
+    }
+
+    Void move(IndexedPriorityQueue &source) noexcept
+    {
+        assert(&source != this && "Tried to move priority queue into itself!");
+        heap.move(source.heap);
+        positions.move(source.positions);
+        values.move(source.values);
+        freeHandles.move(source.freeHandles);
+    }
+
+    Void finalize() noexcept
+    {
+        heap.finalize();
+        positions.finalize();
+        values.finalize();
+        freeHandles.finalize();
+    }
+
+private:
+    Handle get_free_handle() noexcept
+    {
+        if (!freeHandles.is_empty())
+        {
+            return freeHandles.pop_back();
+        }
+
+        values.push_back(Type{});
+        positions.push_back(INVALID_HANDLE);
+        return values.get_size() - 1;
+    }
+
+    // Slot value is finalized, so push can write into it again
+    Void release_handle(const Handle handle) noexcept
+    {
+        if constexpr (Finalizable<Type>)
+        {
+            values[handle].finalize();
+        }
+        positions[handle] = INVALID_HANDLE;
+        freeHandles.push_back(handle);
+    }
+
+    Void assign(const Handle handle, const Type &value) noexcept
+    {
+        if constexpr (Copyable<Type>)
+        {
+            values[handle].copy(value);
+        } else {
+            values[handle] = value;
+        }
+    }
+
+    Void insert_handle(const Handle handle) noexcept
+    {
+        heap.push_back(handle);
+        positions[handle] = heap.get_size() - 1;
+        sift_up(heap.get_size() - 1);
+    }
+
+    Void place(const USize position, const Handle handle) noexcept
+    {
+        heap[position] = handle;
+        positions[handle] = position;
+    }
+
+    Void sift_up(USize position) noexcept
+    {
+        const Handle handle = heap[position];
+        while (position > 0)
+        {
+            const USize parent = (position - 1) / Arity;
+            if (!Compare{}(values[handle], values[heap[parent]]))
+            {
+                break;
+            }
+            place(position, heap[parent]);
+            position = parent;
+        }
+        place(position, handle);
+    }
+
+    Void sift_down(USize position) noexcept
+    {
+        const Handle handle = heap[position];
+        const USize size = heap.get_size();
+        while (true)
+        {
+            const USize firstChild = position * Arity + 1;
+            if (firstChild >= size)
+            {
+                break;
+            }
+
+            USize best = firstChild;
+            const USize lastChild = std::min(firstChild + Arity, size);
+            for (USize child = firstChild + 1; child < lastChild; ++child)
+            {
+                best = Compare{}(values[heap[child]], values[heap[best]]) ? child : best;
+            }
+
+            if (!Compare{}(values[heap[best]], values[handle]))
+            {
+                break;
+            }
+            place(position, heap[best]);
+            position = best;
+        }
+        place(position, handle);
+    }
+};
\ No newline at end of file
@@ -1,24 +1,45 @@
 #pragma once
+#include "rb_node.hpp"
+#include "intrusive_rb_tree.hpp"
 #include "Serrate/Utilities/types.hpp"
 #include "Serrate/Memory/byte.hpp"
 
-struct RBNode;
-// TODO: Add support for RBNode 
+// Free blocks of FreeListAllocator ordered by size, with splitting and coalescing of neighbour blocks
 class RBTree
 {
 private:
+    struct SizeLess
+    {
+        Bool operator()(const RBNode &left, const RBNode &right) const noexcept
+        {
+            return left.get_size() < right.get_size();
+        }
+
+        Bool operator()(const RBNode &left, const USize right) const noexcept
+        {
+            return left.get_size() < right;
+        }
+
+        Bool operator()(const USize left, const RBNode &right) const noexcept
+        {
+            return left < right.get_size();
+        }
+    };
+
+    using Tree = IntrusiveRBTree<RBNode, offsetof(RBNode, hook), SizeLess>;
+
     Byte *memory;
-    RBNode *root;
+    Tree  tree;
 
 public:
     RBTree() noexcept
         : memory(nullptr)
-        , root(nullptr)
+        , tree()
     {}
 
     RBTree(Byte* allocatedMemory) noexcept
         : memory(allocatedMemory)
-        , root(nullptr)
+        , tree()
     {}
 
     Void insert(RBNode *node, Bool shouldCoalesce = true) noexcept;
@@ -38,28 +59,6 @@ public:
 private:
     RBNode *align_node(RBNode *node, USize alignment) const noexcept;
 
-    Void rotate_left(RBNode *node) noexcept;
-
-    Void rotate_right(RBNode *node) noexcept;
-
-    Void transplant(const RBNode *u, RBNode *v) noexcept;
-
-    RBNode *get_min(RBNode *node) const noexcept;
-
-    Void fix_insert(RBNode *node) noexcept;
-
-    Void fix_remove(RBNode *node, RBNode *parent) noexcept;
-
-    // Void print_helper(const RBNode *node, std::string indent, Bool last) noexcept;
-
-    // Mostly used for debug, because size can be duplicated and Its looking for node with specific address It needs to dfs tree sometimes
-    Bool contains(const RBNode *node) const noexcept;
-
     [[nodiscard]]
     Bool validate_tree() const noexcept;
-
-    Bool validate_node(const RBNode *node, const RBNode *parent, Int32 &blackHeight,
-                       const RBNode *minNode, const RBNode *maxNode) const noexcept;
-    Int32 calculate_black_height(const RBNode *node) const noexcept;
-
 };
@@ -0,0 +1,351 @@
+#pragma once
+#include "dynamic_array.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+
+// Array made of fixed size chunks listed in chunk directory. Elements never move, so pointers to them stay
+// valid until they are removed, only directory of chunk pointers is reallocated. Index is split into chunk
+// and offset by shift and mask. Chunks are contiguous, for_each_chunk gives plain loops over them.
+template <Manual Type, USize ChunkCapacity = std::bit_ceil(std::max(USize(16), USize(4096) / sizeof(Type)))>
+requires (std::has_single_bit(ChunkCapacity) && ChunkCapacity > 1)
+class SegmentedArray
+{
+private:
+    static constexpr USize CHUNK_SHIFT = std::countr_zero(ChunkCapacity);
+    static constexpr USize CHUNK_MASK  = ChunkCapacity - 1;
+
+public:
+    struct Iterator
+    {
+    private:
+        SegmentedArray *array;
+        USize           index;
+
+    public:
+        Iterator() noexcept
+        : array(nullptr)
+        , index(0)
+        {}
+
+        Iterator(SegmentedArray *initialArray, const USize initialIndex) noexcept
+        : array(initialArray)
+        , index(initialIndex)
+        {}
+
+        Type &operator*() const noexcept
+        {
+            return (*array)[index];
+        }
+
+        Type *operator->() const noexcept
+        {
+            return &(*array)[index];
+        }
+
+        Void operator++() noexcept
+        {
+            ++index;
+        }
+
+        Void operator--() noexcept
+        {
+            --index;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return index == other.index;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return index != other.index;
+        }
+    };
+
+private:
+    AllocatorInfo       *allocatorInfo;
+    DynamicArray<Type *> chunks;
+    USize                size;
+
+public:
+    SegmentedArray() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , chunks()
+    , size(0)
+    {}
+
+    // Directory can use different allocator than chunks, it holds only pointers
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator(),
+                    AllocatorInfo *directoryAllocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && directoryAllocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        chunks.initialize(directoryAllocator);
+        size = 0;
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        const USize chunkCount = (newCapacity + CHUNK_MASK) >> CHUNK_SHIFT;
+        chunks.reserve(chunkCount);
+        while (chunks.get_size() < chunkCount)
+        {
+            chunks.push_back(Memory::allocate<Type>(allocatorInfo, ChunkCapacity));
+        }
+    }
+
+    Type &push_back(const Type &element) noexcept
+    {
+        Type &target = get_next_slot();
+        if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+        return target;
+    }
+
+    Type &emplace_back(Type &element) noexcept
+    {
+        Type &target = get_next_slot();
+        if constexpr (Moveable<Type>)
+        {
+            target.move(element);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+        return target;
+    }
+
+    Void remove_back() noexcept
+    {
+        assert(size > 0 && "Array is empty!");
+        if constexpr (Finalizable<Type>)
+        {
+            (*this)[size - 1].finalize();
+        }
+        --size;
+    }
+
+    // Remove element and swap with last element, only pointer to last element is invalidated
+    Void remove_swap(const USize index) noexcept
+    {
+        assert(index < size && "Index out of bounds!");
+        if (index == size - 1)
+        {
+            remove_back();
+            return;
+        }
+
+        Type &target = (*this)[index];
+        Type &last = (*this)[size - 1];
+        if constexpr (Finalizable<Type>)
+        {
+            target.finalize();
+        }
+
+        if constexpr (Moveable<Type>)
+        {
+            target.move(last);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(last);
+            if constexpr (Finalizable<Type>)
+            {
+                last.finalize();
+            }
+        } else {
+            target = last;
+        }
+        --size;
+    }
+
+    [[nodiscard("Use remove_back")]]
+    Type pop_back() noexcept
+    {
+        assert(size > 0 && "Array is empty!");
+        Type &last = (*this)[size - 1];
+        Type element;
+        if constexpr (Moveable<Type>)
+        {
+            element.move(last);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            element.copy(last);
+            if constexpr (Finalizable<Type>)
+            {
+                last.finalize();
+            }
+        } else {
+            element = last;
+        }
+        --size;
+        return element;
+    }
+
+    Type &operator[](const USize index) noexcept
+    {
+        assert(index < size);
+        return chunks[index >> CHUNK_SHIFT][index & CHUNK_MASK];
+    }
+
+    [[nodiscard]]
+    const Type &operator[](const USize index) const noexcept
+    {
+        assert(index < size);
+        return chunks[index >> CHUNK_SHIFT][index & CHUNK_MASK];
+    }
+
+    Type &get_first() noexcept
+    {
+        return (*this)[0];
+    }
+
+    Type &get_last() noexcept
+    {
+        return (*this)[size - 1];
+    }
+
+    // Calls function(Type *elements, USize count) for every used chunk in order
+    template <typename Function>
+    Void for_each_chunk(Function &&function) noexcept
+    {
+        USize remaining = size;
+        for (USize i = 0; remaining > 0; ++i)
+        {
+            const USize count = std::min(remaining, ChunkCapacity);
+            function(chunks[i], count);
+            remaining -= count;
+        }
+    }
+
+    template <typename Function>
+    Void for_each_chunk(Function &&function) const noexcept
+    {
+        USize remaining = size;
+        for (USize i = 0; remaining > 0; ++i)
+        {
+            const USize count = std::min(remaining, ChunkCapacity);
+            function(static_cast<const Type *>(chunks[i]), count);
+            remaining -= count;
+        }
+    }
+
+    [[nodiscard]]
+    Iterator begin() noexcept
+    {
+        return Iterator{ this, 0 };
+    }
+
+    [[nodiscard]]
+    Iterator end() noexcept
+    {
+        return Iterator{ this, size };
+    }
+
+    [[nodiscard]]
+    static constexpr USize get_chunk_capacity() noexcept
+    {
+        return ChunkCapacity;
+    }
+
+    [[nodiscard]]
+    USize get_chunk_count() const noexcept
+    {
+        return chunks.get_size();
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return chunks.get_size() << CHUNK_SHIFT;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    // Keeps chunks for later appends
+    Void clear() noexcept
+    {
+        if constexpr (Finalizable<Type>)
+        {
+            for_each_chunk([](Type *elements, const USize count)
+            {
+                for (USize i = 0; i < count; ++i)
+                {
+                    elements[i].finalize();
+                }
+            });
+        }
+        size = 0;
+    }
+
+    Void copy(const SegmentedArray &source) noexcept
+    {
+        assert(&source != this && "Tried to copy segmented array into itself!");
+        finalize();
+        initialize(source.allocatorInfo, source.chunks.get_allocator_info());
+        reserve(source.size);
+        source.for_each_chunk([this](const Type *elements, const USize count)
+        {
+            for (USize i = 0; i < count; ++i)
+            {
+                push_back(elements[i]);
+            }
+        });
+    }
+
+    Void move(SegmentedArray &source) noexcept
+    {
+        assert(&source != this && "Tried to move segmented array into itself!");
+        finalize();
+        allocatorInfo = source.allocatorInfo;
+        chunks.move(source.chunks);
+        size = source.size;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        clear();
+        for (USize i = 0; i < chunks.get_size(); ++i)
+        {
+            Memory::deallocate(allocatorInfo, chunks[i]);
+        }
+        chunks.finalize();
+        *this = {};
+    }
+
+private:
+    Type &get_next_slot() noexcept
+    {
+        if (size == get_capacity())
+        {
+            chunks.push_back(Memory::allocate<Type>(allocatorInfo, ChunkCapacity));
+        }
+        Type &target = chunks[size >> CHUNK_SHIFT][size & CHUNK_MASK];
+        ++size;
+        return target;
+    }
+};
\ No newline at end of file
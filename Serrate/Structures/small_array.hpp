@@ -0,0 +1,382 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <cstring>
+
+// DynamicArray which keeps first InlineCapacity elements inside the object and asks allocator for memory
+// only when it grows past them. Once spilled, elements stay on heap until finalize. Data pointer is
+// chosen by capacity instead of being stored, so SmallArray itself stays relocatable.
+template <Manual Type, USize InlineCapacity = 8>
+requires (InlineCapacity > 0)
+class SmallArray
+{
+private:
+    AllocatorInfo *allocatorInfo;
+    Type          *heapElements;
+    USize          capacity, size;
+    EGrowthPolicy  growthPolicy;
+    Type           inlineElements[InlineCapacity];
+
+public:
+    SmallArray() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , heapElements(nullptr)
+    , capacity(InlineCapacity)
+    , size(0)
+    , growthPolicy(EGrowthPolicy::Geometric)
+    , inlineElements{}
+    {}
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        *this = {};
+        allocatorInfo = allocator;
+    }
+
+    Void reserve(const USize newCapacity) noexcept
+    {
+        if (newCapacity <= capacity)
+        {
+            return;
+        }
+
+        if (is_inline())
+        {
+            Type *newElements = Memory::allocate<Type>(allocatorInfo, newCapacity);
+            relocate(newElements, inlineElements, size);
+            for (USize i = 0; i < size; ++i)
+            {
+                Memory::start_object<Type>(byte_cast(inlineElements + i));
+            }
+            heapElements = newElements;
+        }
+        else if constexpr (Relocatable<Type>)
+        {
+            heapElements = Memory::reallocate(allocatorInfo, heapElements, capacity, newCapacity);
+        } else {
+            Type *newElements = Memory::allocate<Type>(allocatorInfo, newCapacity);
+            relocate(newElements, heapElements, size);
+            Memory::deallocate(allocatorInfo, heapElements);
+            heapElements = newElements;
+        }
+        capacity = newCapacity;
+    }
+
+    Type &push_back(const Type &element) noexcept
+    {
+        if (capacity == size)
+        {
+            reserve(Memory::grow_capacity(capacity, size + 1, growthPolicy));
+        }
+
+        Type &target = get_data()[size];
+        ++size;
+
+        if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+
+        return target;
+    }
+
+    Type &emplace_back(Type &element) noexcept
+    {
+        if (capacity == size)
+        {
+            reserve(Memory::grow_capacity(capacity, size + 1, growthPolicy));
+        }
+
+        Type &target = get_data()[size];
+        ++size;
+
+        if constexpr (Moveable<Type>)
+        {
+            target.move(element);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+
+        return target;
+    }
+
+    Void remove_back() noexcept
+    {
+        assert(size > 0 && "Array is empty!");
+        if constexpr (Finalizable<Type>)
+        {
+            get_data()[size - 1].finalize();
+        }
+        --size;
+    }
+
+    // Remove element and swap with last element
+    Void remove_swap(const USize index) noexcept
+    {
+        assert(index < size && "Index out of bounds!");
+        if (index == size - 1)
+        {
+            remove_back();
+            return;
+        }
+
+        Type *data = get_data();
+        if constexpr (Finalizable<Type>)
+        {
+            data[index].finalize();
+        }
+        relocate(data + index, data + size - 1, 1);
+        Memory::start_object<Type>(byte_cast(data + size - 1));
+        --size;
+    }
+
+    Void remove(const USize index) noexcept
+    {
+        assert(index < size && "Index out of bounds!");
+        Type *data = get_data();
+        if constexpr (Finalizable<Type>)
+        {
+            data[index].finalize();
+        }
+        for (USize i = index + 1; i < size; ++i)
+        {
+            relocate(data + i - 1, data + i, 1);
+        }
+        Memory::start_object<Type>(byte_cast(data + size - 1));
+        --size;
+    }
+
+    [[nodiscard("Use remove_back")]]
+    Type pop_back() noexcept
+    {
+        assert(size > 0 && "Array is empty!");
+        Type element;
+        relocate(&element, get_data() + size - 1, 1);
+        Memory::start_object<Type>(byte_cast(get_data() + size - 1));
+        --size;
+        return element;
+    }
+
+    Void set_growth_policy(const EGrowthPolicy policy) noexcept
+    {
+        growthPolicy = policy;
+    }
+
+    [[nodiscard]]
+    static constexpr USize get_inline_capacity() noexcept
+    {
+        return InlineCapacity;
+    }
+
+    [[nodiscard]]
+    Bool is_inline() const noexcept
+    {
+        return capacity == InlineCapacity;
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Type &operator[](const USize index) noexcept
+    {
+        assert(index < size);
+        return get_data()[index];
+    }
+
+    [[nodiscard]]
+    const Type &operator[](const USize index) const noexcept
+    {
+        assert(index < size);
+        return get_data()[index];
+    }
+
+    Type &get_first() noexcept
+    {
+        assert(size > 0);
+        return get_data()[0];
+    }
+
+    [[nodiscard]]
+    const Type &get_first() const noexcept
+    {
+        assert(size > 0);
+        return get_data()[0];
+    }
+
+    Type &get_last() noexcept
+    {
+        assert(size > 0);
+        return get_data()[size - 1];
+    }
+
+    [[nodiscard]]
+    const Type &get_last() const noexcept
+    {
+        assert(size > 0);
+        return get_data()[size - 1];
+    }
+
+    Type *get_data() noexcept
+    {
+        return is_inline() ? inlineElements : heapElements;
+    }
+
+    [[nodiscard]]
+    const Type *get_data() const noexcept
+    {
+        return is_inline() ? inlineElements : heapElements;
+    }
+
+    Type *begin() noexcept
+    {
+        return get_data();
+    }
+
+    Type *end() noexcept
+    {
+        return get_data() + size;
+    }
+
+    [[nodiscard]]
+    const Type *begin() const noexcept
+    {
+        return get_data();
+    }
+
+    [[nodiscard]]
+    const Type *end() const noexcept
+    {
+        return get_data() + size;
+    }
+
+    [[nodiscard]]
+    Bool contains(const Type &value) const noexcept
+    {
+        const Type *data = get_data();
+        for (USize i = 0; i < size; ++i)
+        {
+            if (data[i] == value)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Void clear() noexcept
+    {
+        if constexpr (Finalizable<Type>)
+        {
+            Type *data = get_data();
+            for (USize i = 0; i < size; ++i)
+            {
+                data[i].finalize();
+            }
+        }
+        size = 0;
+    }
+
+    Void copy(const SmallArray &source) noexcept
+    {
+        assert(&source != this && "Tried to copy small array into itself!");
+        finalize();
+        allocatorInfo = source.allocatorInfo;
+        growthPolicy = source.growthPolicy;
+        reserve(source.size);
+
+        Type *data = get_data();
+        const Type *sourceData = source.get_data();
+        for (USize i = 0; i < source.size; ++i)
+        {
+            if constexpr (Copyable<Type>)
+            {
+                data[i].copy(sourceData[i]);
+            } else {
+                data[i] = sourceData[i];
+            }
+        }
+        size = source.size;
+    }
+
+    Void move(SmallArray &source) noexcept
+    {
+        assert(&source != this && "Tried to move small array into itself!");
+        finalize();
+        allocatorInfo = source.allocatorInfo;
+        growthPolicy = source.growthPolicy;
+        if (source.is_inline())
+        {
+            relocate(inlineElements, source.inlineElements, source.size);
+        } else {
+            heapElements = source.heapElements;
+            capacity = source.capacity;
+        }
+        size = source.size;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        clear();
+        if (!is_inline())
+        {
+            Memory::deallocate(allocatorInfo, heapElements);
+        }
+        *this = {};
+    }
+
+private:
+    // Moves count elements to uninitialized or default constructed target, source is left reusable
+    static Void relocate(Type *target, Type *source, const USize count) noexcept
+    {
+        if constexpr (Relocatable<Type>)
+        {
+            if (count > 0)
+            {
+                std::memcpy(static_cast<Void *>(target), source, count * sizeof(Type));
+            }
+        } else {
+            for (USize i = 0; i < count; ++i)
+            {
+                if constexpr (Moveable<Type>)
+                {
+                    target[i].move(source[i]);
+                }
+                else if constexpr (Copyable<Type>)
+                {
+                    target[i].copy(source[i]);
+                    if constexpr (Finalizable<Type>)
+                    {
+                        source[i].finalize();
+                    }
+                } else {
+                    target[i] = source[i];
+                }
+            }
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,466 @@
+#pragma once
+#include "view.hpp"
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+// Structure of arrays, every type gets its own contiguous column and all columns share one allocation.
+// Loops over one field stream only its column, so they vectorize and do not pull other fields into cache.
+// Rows are returned as View of references, so structured bindings work: auto [position, velocity] = array[i].
+// Iterating by value (for (auto [a, b] : array)) still writes through to columns.
+template <Manual... Types>
+requires (sizeof...(Types) > 0)
+class SoAArray
+{
+private:
+    static constexpr USize COLUMN_COUNT = sizeof...(Types);
+
+    // Columns start on cache line, so first elements of every column are aligned for vector loads
+    static constexpr USize COLUMN_ALIGNMENT = std::max({ Memory::CACHE_LINE_SIZE, alignof(Types)... });
+
+    template <USize Index>
+    using ColumnType = std::tuple_element_t<Index, View<Types...>>;
+
+    template <typename Type>
+    static constexpr USize get_column_index() noexcept
+    {
+        constexpr Bool matches[] = { std::is_same_v<Type, Types>... };
+        static_assert((USize(std::is_same_v<Type, Types>) + ...) == 1, "Type has to be in SoAArray exactly once!");
+        return USize(std::find(matches, matches + COLUMN_COUNT, true) - matches);
+    }
+
+public:
+    using Reference      = View<Types &...>;
+    using ConstReference = View<const Types &...>;
+
+    struct Iterator
+    {
+    private:
+        SoAArray *array;
+        USize     index;
+
+    public:
+        Iterator() noexcept
+        : array(nullptr)
+        , index(0)
+        {}
+
+        Iterator(SoAArray *initialArray, const USize initialIndex) noexcept
+        : array(initialArray)
+        , index(initialIndex)
+        {}
+
+        Reference operator*() const noexcept
+        {
+            return (*array)[index];
+        }
+
+        [[nodiscard]]
+        USize get_index() const noexcept
+        {
+            return index;
+        }
+
+        Void operator++() noexcept
+        {
+            ++index;
+        }
+
+        Void operator--() noexcept
+        {
+            --index;
+        }
+
+        Bool operator==(const Iterator &other) const noexcept
+        {
+            return index == other.index;
+        }
+
+        Bool operator!=(const Iterator &other) const noexcept
+        {
+            return index != other.index;
+        }
+    };
+
+private:
+    AllocatorInfo *allocatorInfo;
+    Byte          *memory;
+    Void          *columns[COLUMN_COUNT];
+    USize          capacity, size;
+    EGrowthPolicy  growthPolicy;
+
+public:
+    SoAArray() noexcept
+    : allocatorInfo(AllocatorInfo::get_default_allocator())
+    , memory(nullptr)
+    , columns{}
+    , capacity(0)
+    , size(0)
+    , growthPolicy(EGrowthPolicy::Geometric)
+    {}
+
+    Void initialize(const USize initialCapacity, AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        initialize(allocator);
+        reserve(initialCapacity);
+    }
+
+    Void initialize(AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        *this = {};
+        allocatorInfo = allocator;
+    }
+
+    // Moves every column to new block, capacity never shrinks
+    Void reserve(const USize newCapacity) noexcept
+    {
+        if (newCapacity <= capacity)
+        {
+            return;
+        }
+
+        USize offsets[COLUMN_COUNT];
+        const USize bytes = get_column_offsets(newCapacity, offsets);
+        Byte *newMemory = allocatorInfo->allocate(allocatorInfo->allocator, bytes, COLUMN_ALIGNMENT);
+        assert(newMemory && "Failed to allocate columns!");
+
+        for_each_column([&]<USize Index>()
+        {
+            using Type = ColumnType<Index>;
+            Type *source = get_column<Index>();
+            Type *target = reinterpret_cast<Type *>(newMemory + offsets[Index]);
+            if constexpr (Relocatable<Type>)
+            {
+                if (size > 0)
+                {
+                    std::memcpy(static_cast<Void *>(target), source, size * sizeof(Type));
+                }
+            } else {
+                for (USize i = 0; i < size; ++i)
+                {
+                    Memory::start_object<Type>(byte_cast(target + i));
+                    relocate(target[i], source[i]);
+                }
+            }
+
+            for (USize i = size; i < newCapacity; ++i)
+            {
+                Memory::start_object<Type>(byte_cast(target + i));
+            }
+            columns[Index] = std::launder(target);
+        });
+
+        if (memory)
+        {
+            allocatorInfo->deallocate(allocatorInfo->allocator, memory);
+        }
+        memory = newMemory;
+        capacity = newCapacity;
+    }
+
+    // Returns index of new row
+    USize push_back(const Types &...values) noexcept
+    {
+        const USize index = get_next_row();
+        set_row(index, std::make_index_sequence<COLUMN_COUNT>{}, values...);
+        return index;
+    }
+
+    USize emplace_back(Types &...values) noexcept
+    {
+        const USize index = get_next_row();
+        take_row(index, std::make_index_sequence<COLUMN_COUNT>{}, values...);
+        return index;
+    }
+
+    Void remove_back() noexcept
+    {
+        assert(size > 0 && "Array is empty!");
+        --size;
+        for_each_column([&]<USize Index>()
+        {
+            using Type = ColumnType<Index>;
+            if constexpr (Finalizable<Type>)
+            {
+                get_column<Index>()[size].finalize();
+            }
+        });
+    }
+
+    // Remove row and move last row into its place
+    Void remove_swap(const USize index) noexcept
+    {
+        assert(index < size && "Index out of bounds!");
+        const USize last = size - 1;
+        for_each_column([&]<USize Index>()
+        {
+            using Type = ColumnType<Index>;
+            Type *column = get_column<Index>();
+            if constexpr (Finalizable<Type>)
+            {
+                column[index].finalize();
+            }
+
+            if (index != last)
+            {
+                relocate(column[index], column[last]);
+                Memory::start_object<Type>(byte_cast(column + last));
+            }
+        });
+        --size;
+    }
+
+    Reference operator[](const USize index) noexcept
+    {
+        assert(index < size);
+        return get_row(index, std::make_index_sequence<COLUMN_COUNT>{});
+    }
+
+    [[nodiscard]]
+    ConstReference operator[](const USize index) const noexcept
+    {
+        assert(index < size);
+        return get_row(index, std::make_index_sequence<COLUMN_COUNT>{});
+    }
+
+    // Column pointers stay valid until next growth
+    template <USize Index>
+    ColumnType<Index> *get_column() noexcept
+    {
+        static_assert(Index < COLUMN_COUNT, "Column index out of bounds!");
+        return static_cast<ColumnType<Index> *>(columns[Index]);
+    }
+
+    template <USize Index>
+    [[nodiscard]]
+    const ColumnType<Index> *get_column() const noexcept
+    {
+        static_assert(Index < COLUMN_COUNT, "Column index out of bounds!");
+        return static_cast<const ColumnType<Index> *>(columns[Index]);
+    }
+
+    template <typename Type>
+    Type *get_column() noexcept
+    {
+        return get_column<get_column_index<Type>()>();
+    }
+
+    template <typename Type>
+    [[nodiscard]]
+    const Type *get_column() const noexcept
+    {
+        return get_column<get_column_index<Type>()>();
+    }
+
+    [[nodiscard]]
+    Iterator begin() noexcept
+    {
+        return Iterator{ this, 0 };
+    }
+
+    [[nodiscard]]
+    Iterator end() noexcept
+    {
+        return Iterator{ this, size };
+    }
+
+    Void set_growth_policy(const EGrowthPolicy policy) noexcept
+    {
+        growthPolicy = policy;
+    }
+
+    [[nodiscard]]
+    EGrowthPolicy get_growth_policy() const noexcept
+    {
+        return growthPolicy;
+    }
+
+    [[nodiscard]]
+    static constexpr USize get_column_count() noexcept
+    {
+        return COLUMN_COUNT;
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    Void clear() noexcept
+    {
+        for_each_column([&]<USize Index>()
+        {
+            using Type = ColumnType<Index>;
+            if constexpr (Finalizable<Type>)
+            {
+                Type *column = get_column<Index>();
+                for (USize i = 0; i < size; ++i)
+                {
+                    column[i].finalize();
+                }
+            }
+        });
+        size = 0;
+    }
+
+    Void copy(const SoAArray &source) noexcept
+    {
+        assert(&source != this && "Tried to copy soa array into itself!");
+        finalize();
+        allocatorInfo = source.allocatorInfo;
+        growthPolicy = source.growthPolicy;
+        reserve(source.size);
+
+        for_each_column([&]<USize Index>()
+        {
+            using Type = ColumnType<Index>;
+            Type *column = get_column<Index>();
+            const Type *sourceColumn = source.template get_column<Index>();
+            for (USize i = 0; i < source.size; ++i)
+            {
+                if constexpr (Copyable<Type>)
+                {
+                    column[i].copy(sourceColumn[i]);
+                } else {
+                    column[i] = sourceColumn[i];
+                }
+            }
+        });
+        size = source.size;
+    }
+
+    Void move(SoAArray &source) noexcept
+    {
+        assert(&source != this && "Tried to move soa array into itself!");
+        finalize();
+        *this = source;
+        source = {};
+    }
+
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        clear();
+        if (memory)
+        {
+            allocatorInfo->deallocate(allocatorInfo->allocator, memory);
+        }
+        *this = {};
+    }
+
+private:
+    // Fills offsets of columns for given capacity and returns size of whole block
+    static USize get_column_offsets(const USize columnCapacity, USize *offsets) noexcept
+    {
+        constexpr USize sizes[] = { sizeof(Types)... };
+        USize offset = 0;
+        for (USize i = 0; i < COLUMN_COUNT; ++i)
+        {
+            offsets[i] = offset;
+            offset = Memory::align_offset(offset + columnCapacity * sizes[i], COLUMN_ALIGNMENT);
+        }
+        return offset;
+    }
+
+    // Calls function.template operator()<Index>() for every column
+    template <typename Function>
+    static Void for_each_column(Function &&function) noexcept
+    {
+        [&]<USize... Indices>(std::index_sequence<Indices...>)
+        {
+            (function.template operator()<Indices>(), ...);
+        }(std::make_index_sequence<COLUMN_COUNT>{});
+    }
+
+    template <Manual Type>
+    static Void relocate(Type &target, Type &source) noexcept
+    {
+        if constexpr (Moveable<Type>)
+        {
+            target.move(source);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(source);
+            if constexpr (Finalizable<Type>)
+            {
+                source.finalize();
+            }
+        } else {
+            target = source;
+        }
+    }
+
+    USize get_next_row() noexcept
+    {
+        if (capacity == size)
+        {
+            reserve(Memory::grow_capacity(capacity, size + 1, growthPolicy));
+        }
+        return size++;
+    }
+
+    template <USize... Indices>
+    Void set_row(const USize index, std::index_sequence<Indices...>, const Types &...values) noexcept
+    {
+        ([&]()
+        {
+            using Type = ColumnType<Indices>;
+            if constexpr (Copyable<Type>)
+            {
+                get_column<Indices>()[index].copy(values);
+            } else {
+                get_column<Indices>()[index] = values;
+            }
+        }(), ...);
+    }
+
+    template <USize... Indices>
+    Void take_row(const USize index, std::index_sequence<Indices...>, Types &...values) noexcept
+    {
+        ([&]()
+        {
+            using Type = ColumnType<Indices>;
+            if constexpr (Moveable<Type>)
+            {
+                get_column<Indices>()[index].move(values);
+            }
+            else if constexpr (Copyable<Type>)
+            {
+                get_column<Indices>()[index].copy(values);
+            } else {
+                get_column<Indices>()[index] = values;
+            }
+        }(), ...);
+    }
+
+    template <USize... Indices>
+    Reference get_row(const USize index, std::index_sequence<Indices...>) noexcept
+    {
+        return Reference{ get_column<Indices>()[index]... };
+    }
+
+    template <USize... Indices>
+    [[nodiscard]]
+    ConstReference get_row(const USize index, std::index_sequence<Indices...>) const noexcept
+    {
+        return ConstReference{ get_column<Indices>()[index]... };
+    }
+};
\ No newline at end of file
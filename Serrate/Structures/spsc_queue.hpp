@@ -0,0 +1,271 @@
+#pragma once
+#include "Serrate/Utilities/types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+// Bounded queue between exactly one producer thread and one consumer thread, push and pop are wait free.
+// Head (written by consumer) and tail (written by producer) live on separate cache lines, each side also
+// keeps its last seen copy of other side's index and reloads it only when queue looks full or empty, so in
+// steady state threads do not touch each other's lines. Capacity is power of two and indices are masked.
+// Slots are reused in place, popped slot is left empty by move() so producer can write into it again.
+// initialize and finalize are not thread safe.
+template <Manual Type>
+class SPSCQueue
+{
+private:
+    // Consumer side
+    alignas(Memory::CACHE_LINE_SIZE) std::atomic<USize> head;
+    USize cachedTail;
+
+    // Producer side
+    alignas(Memory::CACHE_LINE_SIZE) std::atomic<USize> tail;
+    USize cachedHead;
+
+    // Shared and read only after initialize
+    alignas(Memory::CACHE_LINE_SIZE) AllocatorInfo *allocatorInfo;
+    Type *elements;
+    USize capacity;
+    Bool  isStorageOwned;
+
+public:
+    SPSCQueue() noexcept
+    : head(0)
+    , cachedTail(0)
+    , tail(0)
+    , cachedHead(0)
+    , allocatorInfo(AllocatorInfo::get_default_allocator())
+    , elements(nullptr)
+    , capacity(0)
+    , isStorageOwned(false)
+    {}
+
+    // Capacity is rounded up to power of two
+    Void initialize(const USize initialCapacity, AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        allocatorInfo = allocator;
+        capacity = std::bit_ceil(std::max(initialCapacity, USize(2)));
+        elements = Memory::allocate<Type>(allocatorInfo, capacity);
+        isStorageOwned = true;
+        reset_indices();
+    }
+
+    // Uses storage owned by caller (for example Array::get_data()), count has to be power of two and
+    // elements default constructed. Storage has to outlive the queue.
+    Void initialize(Type *storage, const USize storageCount) noexcept
+    {
+        assert(storage && "Storage is nullptr!");
+        assert(std::has_single_bit(storageCount) && "Storage count has to be power of two!");
+        allocatorInfo = AllocatorInfo::get_default_allocator();
+        elements = storage;
+        capacity = storageCount;
+        isStorageOwned = false;
+        reset_indices();
+    }
+
+    // Producer only
+    Bool try_push(const Type &element) noexcept
+    {
+        const USize position = tail.load(std::memory_order_relaxed);
+        if (!has_free_slots(position, 1))
+        {
+            return false;
+        }
+
+        Type &target = elements[position & (capacity - 1)];
+        if constexpr (Copyable<Type>)
+        {
+            target.copy(element);
+        } else {
+            target = element;
+        }
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer only, element is left empty on success
+    Bool try_emplace(Type &element) noexcept
+    {
+        const USize position = tail.load(std::memory_order_relaxed);
+        if (!has_free_slots(position, 1))
+        {
+            return false;
+        }
+
+        take(elements[position & (capacity - 1)], element);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer only, copies as many elements as fit and publishes them at once, returns their count
+    USize push_batch(const Type *source, const USize count) noexcept
+    {
+        const USize position = tail.load(std::memory_order_relaxed);
+        USize free = capacity - (position - cachedHead);
+        if (free < count)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            free = capacity - (position - cachedHead);
+        }
+
+        const USize pushCount = std::min(free, count);
+        for (USize i = 0; i < pushCount; ++i)
+        {
+            Type &target = elements[(position + i) & (capacity - 1)];
+            if constexpr (Copyable<Type>)
+            {
+                target.copy(source[i]);
+            } else {
+                target = source[i];
+            }
+        }
+        if (pushCount > 0)
+        {
+            tail.store(position + pushCount, std::memory_order_release);
+        }
+        return pushCount;
+    }
+
+    // Consumer only, popped element is moved into element same way as move() does
+    Bool try_pop(Type &element) noexcept
+    {
+        const USize position = head.load(std::memory_order_relaxed);
+        if (!has_ready_slots(position, 1))
+        {
+            return false;
+        }
+
+        take(element, elements[position & (capacity - 1)]);
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only, target slots have to be empty or default constructed, returns number of popped elements
+    USize pop_batch(Type *target, const USize count) noexcept
+    {
+        const USize position = head.load(std::memory_order_relaxed);
+        USize ready = cachedTail - position;
+        if (ready < count)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            ready = cachedTail - position;
+        }
+
+        const USize popCount = std::min(ready, count);
+        for (USize i = 0; i < popCount; ++i)
+        {
+            take(target[i], elements[(position + i) & (capacity - 1)]);
+        }
+        if (popCount > 0)
+        {
+            head.store(position + popCount, std::memory_order_release);
+        }
+        return popCount;
+    }
+
+    // Consumer only, returns nullptr when queue is empty. Element stays in queue until pop
+    [[nodiscard]]
+    Type *get_front() noexcept
+    {
+        const USize position = head.load(std::memory_order_relaxed);
+        return has_ready_slots(position, 1) ? &elements[position & (capacity - 1)] : nullptr;
+    }
+
+    // Exact only from producer or consumer thread and only for its own side
+    [[nodiscard]]
+    USize get_size() const noexcept
+    {
+        const USize currentTail = tail.load(std::memory_order_acquire);
+        const USize currentHead = head.load(std::memory_order_acquire);
+        return currentTail - currentHead;
+    }
+
+    [[nodiscard]]
+    Bool is_empty() const noexcept
+    {
+        return get_size() == 0;
+    }
+
+    [[nodiscard]]
+    USize get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    // Finalizes elements left in queue
+    Void finalize() noexcept
+    {
+        assert(allocatorInfo && "Allocator is nullptr!");
+        if constexpr (Finalizable<Type>)
+        {
+            const USize end = tail.load(std::memory_order_acquire);
+            for (USize position = head.load(std::memory_order_acquire); position != end; ++position)
+            {
+                elements[position & (capacity - 1)].finalize();
+            }
+        }
+
+        if (isStorageOwned && elements)
+        {
+            Memory::deallocate(allocatorInfo, elements);
+        }
+        allocatorInfo = AllocatorInfo::get_default_allocator();
+        elements = nullptr;
+        capacity = 0;
+        isStorageOwned = false;
+        reset_indices();
+    }
+
+private:
+    Void reset_indices() noexcept
+    {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        cachedTail = 0;
+        cachedHead = 0;
+    }
+
+    // Producer side check, reloads head only when cached one says queue is full
+    Bool has_free_slots(const USize position, const USize count) noexcept
+    {
+        if (position - cachedHead + count <= capacity)
+        {
+            return true;
+        }
+        cachedHead = head.load(std::memory_order_acquire);
+        return position - cachedHead + count <= capacity;
+    }
+
+    // Consumer side check, reloads tail only when cached one says queue is empty
+    Bool has_ready_slots(const USize position, const USize count) noexcept
+    {
+        if (cachedTail - position >= count)
+        {
+            return true;
+        }
+        cachedTail = tail.load(std::memory_order_acquire);
+        return cachedTail - position >= count;
+    }
+
+    // Source is left empty, so slot can be reused without finalize
+    static Void take(Type &target, Type &source) noexcept
+    {
+        if constexpr (Moveable<Type>)
+        {
+            target.move(source);
+        }
+        else if constexpr (Copyable<Type>)
+        {
+            target.copy(source);
+            if constexpr (Finalizable<Type>)
+            {
+                source.finalize();
+            }
+        } else {
+            target = source;
+        }
+    }
+};
\ No newline at end of file
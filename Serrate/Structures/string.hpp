@@ -908,7 +908,7 @@ public:
             elements = source.elements;
         } else {
             elements = Memory::allocate<Type, false>(allocatorInfo, capacity);
-            memcpy(elements, source.elements, size * sizeof(Type));
+            memcpy(elements, source.elements, (size + 1) * sizeof(Type));
         }
     }
 
@@ -21,10 +21,11 @@ public:
     , value(v)
     {}
 
+    // View of references (like SoAArray rows) is searched by referenced type
     template<typename RequestedType>
     RequestedType &get_value() noexcept
     {
-        if constexpr (std::is_same_v<RequestedType, Type>)
+        if constexpr (std::is_same_v<RequestedType, std::remove_reference_t<Type>>)
         {
             return value;
         } else {
@@ -36,7 +37,7 @@ public:
     [[nodiscard]]
     const RequestedType &get_value() const noexcept
     {
-        if constexpr (std::is_same_v<RequestedType, Type>)
+        if constexpr (std::is_same_v<RequestedType, std::remove_reference_t<Type>>)
         {
             return value;
         } else {
@@ -0,0 +1,222 @@
+#pragma once
+#include "sort.hpp"
+#include "types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <thread>
+
+// Parallel merge sort. Array is split into one chunk per thread, chunks are sorted independently and then
+// merged pairwise in log2(threads) rounds through scratch buffer. Every round splits whole output evenly
+// between threads, split points inside each merge are found by binary search (merge path), so threads get
+// equal work even when runs differ in size. Compare is shared by all threads and has to be safe to call
+// concurrently. Scratch buffer is requested from allocator on calling thread only.
+namespace Sort
+{
+    enum class EParallelSortMode
+    {
+        Fast,          // Chunks use unstable sort, order of equal elements depends on thread count
+        Deterministic, // Stable, result is same as stable_sort for any thread count
+    };
+
+    // Smaller arrays are sorted on calling thread, thread start costs more than it saves
+    constexpr USize MIN_PARALLEL_SORT_SIZE = 16 * 1024;
+    constexpr USize MAX_SORT_THREAD_COUNT  = 64;
+
+    namespace Detail
+    {
+        // Number of elements from left among first outputIndex elements of stable merge
+        template <Manual Type, typename Compare>
+        [[nodiscard]]
+        USize get_merge_split(const Type *left, const USize leftCount, const Type *right, const USize rightCount,
+                              const USize outputIndex, Compare &compare) noexcept
+        {
+            USize low = outputIndex > rightCount ? outputIndex - rightCount : 0;
+            USize high = std::min(outputIndex, leftCount);
+            while (low < high)
+            {
+                const USize middle = low + (high - low) / 2;
+                if (!compare(right[outputIndex - middle - 1], left[middle]))
+                {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            return low;
+        }
+
+        // Merges part [outputBegin, outputEnd) of merged output, which starts at leftBegin and ends at leftEnd
+        // in left run
+        template <Manual Type, typename Compare>
+        Void merge_part(Type *left, Type *right, Type *target, const USize outputBegin, const USize outputEnd,
+                        const USize leftBegin, const USize leftEnd, Compare &compare) noexcept
+        {
+            merge(left + leftBegin, left + leftEnd,
+                  right + (outputBegin - leftBegin), right + (outputEnd - leftEnd),
+                  target + outputBegin, compare);
+        }
+
+        // Calls function(threadIndex) on threadCount threads, calling thread takes index 0
+        template <typename Function>
+        Void run_on_threads(const USize threadCount, Function &function) noexcept
+        {
+            std::thread workers[MAX_SORT_THREAD_COUNT];
+            for (USize i = 1; i < threadCount; ++i)
+            {
+                workers[i] = std::thread([&function, i]() { function(i); });
+            }
+            function(0);
+            for (USize i = 1; i < threadCount; ++i)
+            {
+                workers[i].join();
+            }
+        }
+
+        [[nodiscard]]
+        inline USize get_sort_thread_count(const USize count, const USize requested) noexcept
+        {
+            USize threadCount = requested ? requested : USize(std::thread::hardware_concurrency());
+            threadCount = std::min(threadCount, count / MIN_PARALLEL_SORT_SIZE);
+            return std::clamp(threadCount, USize(1), MAX_SORT_THREAD_COUNT);
+        }
+    }
+
+    // Stable merge of two sorted ranges into target, which must not overlap them. Target slots have to be
+    // default constructed, merged elements are moved out of left and right.
+    template <Manual Type, typename Compare = Less>
+    Void parallel_merge(Type *left, const USize leftCount, Type *right, const USize rightCount, Type *target,
+                        Compare compare = Compare{}, const USize threadCount = 0) noexcept
+    {
+        const USize count = leftCount + rightCount;
+        const USize usedThreads = Detail::get_sort_thread_count(count, threadCount);
+
+        // Split points are found before merging, merged pinned elements are left empty in source
+        USize splits[MAX_SORT_THREAD_COUNT + 1];
+        for (USize i = 0; i <= usedThreads; ++i)
+        {
+            splits[i] = Detail::get_merge_split(left, leftCount, right, rightCount, count * i / usedThreads, compare);
+        }
+
+        auto mergeRange = [&](const USize thread)
+        {
+            Detail::merge_part(left, right, target, count * thread / usedThreads, count * (thread + 1) / usedThreads,
+                               splits[thread], splits[thread + 1], compare);
+        };
+        Detail::run_on_threads(usedThreads, mergeRange);
+    }
+
+    // Thread count 0 uses all hardware threads. Allocates buffer of count elements.
+    template <Manual Type, typename Compare = Less>
+    Void parallel_sort(Type *data, const USize count, Compare compare = Compare{},
+                       AllocatorInfo *allocator = AllocatorInfo::get_default_allocator(),
+                       const EParallelSortMode mode = EParallelSortMode::Fast, const USize threadCount = 0) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        const USize usedThreads = Detail::get_sort_thread_count(count, threadCount);
+        if (usedThreads == 1)
+        {
+            if (mode == EParallelSortMode::Deterministic)
+            {
+                Sort::stable_sort(data, count, compare, allocator);
+            } else {
+                Sort::sort(data, count, compare);
+            }
+            return;
+        }
+
+        Type *buffer = Memory::allocate<Type>(allocator, count);
+
+        // Run bounds, run i is [bounds[i], bounds[i + 1])
+        USize bounds[MAX_SORT_THREAD_COUNT + 1];
+        USize runCount = usedThreads;
+        for (USize i = 0; i <= runCount; ++i)
+        {
+            bounds[i] = count * i / runCount;
+        }
+
+        auto sortChunk = [&](const USize thread)
+        {
+            const USize begin = bounds[thread];
+            const USize chunkCount = bounds[thread + 1] - begin;
+            if (mode == EParallelSortMode::Deterministic)
+            {
+                Detail::merge_sort(data + begin, chunkCount, buffer + begin, compare);
+            } else {
+                Sort::sort(data + begin, chunkCount, compare);
+            }
+        };
+        Detail::run_on_threads(usedThreads, sortChunk);
+
+        Type *source = data;
+        Type *target = buffer;
+        USize splits[MAX_SORT_THREAD_COUNT + 1] = {};
+        while (runCount > 1)
+        {
+            // Split points inside merges are found before merging, merged pinned elements are left empty in
+            // source, so threads must not search through them
+            for (USize thread = 1; thread < usedThreads; ++thread)
+            {
+                const USize position = count * thread / usedThreads;
+                for (USize run = 0; run < runCount; run += 2)
+                {
+                    const USize begin = bounds[run];
+                    const USize middle = bounds[std::min(run + 1, runCount)];
+                    const USize end = bounds[std::min(run + 2, runCount)];
+                    if (begin < position && position < end)
+                    {
+                        splits[thread] = Detail::get_merge_split(source + begin, middle - begin, source + middle,
+                                                                 end - middle, position - begin, compare);
+                        break;
+                    }
+                }
+            }
+
+            // Every thread produces same share of output, walking over merges its share overlaps
+            auto mergeRound = [&](const USize thread)
+            {
+                const USize outputBegin = count * thread / usedThreads;
+                const USize outputEnd = count * (thread + 1) / usedThreads;
+                for (USize run = 0; run < runCount; run += 2)
+                {
+                    const USize begin = bounds[run];
+                    const USize middle = bounds[std::min(run + 1, runCount)];
+                    const USize end = bounds[std::min(run + 2, runCount)];
+                    if (end <= outputBegin || begin >= outputEnd)
+                    {
+                        continue;
+                    }
+
+                    const USize leftBegin = outputBegin > begin ? splits[thread] : 0;
+                    const USize leftEnd = outputEnd < end ? splits[thread + 1] : middle - begin;
+                    Detail::merge_part(source + begin, source + middle, target + begin,
+                                       std::max(begin, outputBegin) - begin, std::min(end, outputEnd) - begin,
+                                       leftBegin, leftEnd, compare);
+                }
+            };
+            Detail::run_on_threads(usedThreads, mergeRound);
+
+            const USize mergedCount = (runCount + 1) / 2;
+            for (USize i = 0; i <= mergedCount; ++i)
+            {
+                bounds[i] = bounds[std::min(2 * i, runCount)];
+            }
+            runCount = mergedCount;
+            std::swap(source, target);
+        }
+
+        if (source != data)
+        {
+            auto moveBack = [&](const USize thread)
+            {
+                const USize end = count * (thread + 1) / usedThreads;
+                for (USize i = count * thread / usedThreads; i < end; ++i)
+                {
+                    Detail::relocate(data[i], source[i]);
+                }
+            };
+            Detail::run_on_threads(usedThreads, moveBack);
+        }
+        Memory::deallocate(allocator, buffer);
+    }
+}
\ No newline at end of file
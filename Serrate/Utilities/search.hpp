@@ -0,0 +1,61 @@
+#pragma once
+#include "types.hpp"
+
+namespace Search
+{
+    // Branchless binary search, loop only halves range and compiler turns the step into conditional move,
+    // so there is no mispredicted jump per level. Returns index of first element not less than value.
+    template <Ordered Type>
+    [[nodiscard]]
+    constexpr USize lower_bound(const Type *data, const USize count, const Type &value) noexcept
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const Type *base = data;
+        USize length = count;
+        while (length > 1)
+        {
+            const USize half = length / 2;
+            base = (base[half - 1] < value) ? base + half : base;
+            length -= half;
+        }
+        return USize(base - data) + USize(*base < value);
+    }
+
+    // Returns index of first element greater than value
+    template <Ordered Type>
+    [[nodiscard]]
+    constexpr USize upper_bound(const Type *data, const USize count, const Type &value) noexcept
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const Type *base = data;
+        USize length = count;
+        while (length > 1)
+        {
+            const USize half = length / 2;
+            base = !(value < base[half - 1]) ? base + half : base;
+            length -= half;
+        }
+        return USize(base - data) + USize(!(value < *base));
+    }
+
+    // Returns index of element equal to value or ~USize(0)
+    template <Ordered Type>
+    [[nodiscard]]
+    constexpr USize find(const Type *data, const USize count, const Type &value) noexcept
+    {
+        const USize index = lower_bound(data, count, value);
+        if (index < count && !(value < data[index]))
+        {
+            return index;
+        }
+        return ~USize(0);
+    }
+}
\ No newline at end of file
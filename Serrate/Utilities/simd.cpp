@@ -0,0 +1,127 @@
+#include "simd.hpp"
+
+#include <cassert>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SERRATE_SIMD_X64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// Plain loops, used on other architectures and as reference for benchmarks
+#define SIMD_KERNEL_NAMESPACE Simd::Scalar
+#define SIMD_KERNEL_WIDTH 0
+#include "simd_kernels.inl"
+#undef SIMD_KERNEL_NAMESPACE
+#undef SIMD_KERNEL_WIDTH
+
+#if defined(SERRATE_SIMD_X64)
+#define SIMD_KERNEL_NAMESPACE Simd::Sse2
+#define SIMD_KERNEL_WIDTH 16
+#include "simd_kernels.inl"
+#undef SIMD_KERNEL_NAMESPACE
+#undef SIMD_KERNEL_WIDTH
+#endif
+
+#if defined(SERRATE_SIMD_X64)
+namespace Simd::Avx2
+{
+    // Defined in simd_avx2.cpp, which is the only file compiled with AVX2 enabled
+    template <Arithmetic Type>
+    const Kernels<Type> &get_kernels() noexcept;
+}
+#endif
+
+namespace Simd
+{
+    namespace
+    {
+        EInstructionSet detect_instruction_set() noexcept
+        {
+#if defined(SERRATE_SIMD_X64)
+#if defined(_MSC_VER)
+            Int32 info[4] = {};
+            __cpuid(info, 0);
+            if (info[0] >= 7)
+            {
+                __cpuid(info, 1);
+                const Bool isOsSavingYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+                __cpuidex(info, 7, 0);
+                if (isOsSavingYmm && (info[1] & (1 << 5)))
+                {
+                    return EInstructionSet::Avx2;
+                }
+            }
+#else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return EInstructionSet::Avx2;
+            }
+#endif
+            return EInstructionSet::Sse2;
+#else
+            return EInstructionSet::Scalar;
+#endif
+        }
+    }
+
+    EInstructionSet get_instruction_set() noexcept
+    {
+        static const EInstructionSet instructionSet = detect_instruction_set();
+        return instructionSet;
+    }
+
+    template <Arithmetic Type>
+    const Kernels<Type> &get_kernels() noexcept
+    {
+        static const Kernels<Type> &kernels = *get_kernels<Type>(get_instruction_set());
+        return kernels;
+    }
+
+    template <Arithmetic Type>
+    const Kernels<Type> *get_kernels(const EInstructionSet instructionSet) noexcept
+    {
+        if (instructionSet > get_instruction_set())
+        {
+            return nullptr;
+        }
+
+        switch (instructionSet)
+        {
+#if defined(SERRATE_SIMD_X64)
+            case EInstructionSet::Avx2:
+                return &Avx2::get_kernels<Type>();
+            case EInstructionSet::Sse2:
+                return &Sse2::KERNELS<Type>;
+#endif
+            default:
+                return &Scalar::KERNELS<Type>;
+        }
+    }
+
+    template const Kernels<Char   > &get_kernels<Char   >() noexcept;
+    template const Kernels<Int8   > &get_kernels<Int8   >() noexcept;
+    template const Kernels<UInt8  > &get_kernels<UInt8  >() noexcept;
+    template const Kernels<Int16  > &get_kernels<Int16  >() noexcept;
+    template const Kernels<UInt16 > &get_kernels<UInt16 >() noexcept;
+    template const Kernels<Int32  > &get_kernels<Int32  >() noexcept;
+    template const Kernels<UInt32 > &get_kernels<UInt32 >() noexcept;
+    template const Kernels<Int64  > &get_kernels<Int64  >() noexcept;
+    template const Kernels<UInt64 > &get_kernels<UInt64 >() noexcept;
+    template const Kernels<Float32> &get_kernels<Float32>() noexcept;
+    template const Kernels<Float64> &get_kernels<Float64>() noexcept;
+
+    template const Kernels<Char   > *get_kernels<Char   >(EInstructionSet) noexcept;
+    template const Kernels<Int8   > *get_kernels<Int8   >(EInstructionSet) noexcept;
+    template const Kernels<UInt8  > *get_kernels<UInt8  >(EInstructionSet) noexcept;
+    template const Kernels<Int16  > *get_kernels<Int16  >(EInstructionSet) noexcept;
+    template const Kernels<UInt16 > *get_kernels<UInt16 >(EInstructionSet) noexcept;
+    template const Kernels<Int32  > *get_kernels<Int32  >(EInstructionSet) noexcept;
+    template const Kernels<UInt32 > *get_kernels<UInt32 >(EInstructionSet) noexcept;
+    template const Kernels<Int64  > *get_kernels<Int64  >(EInstructionSet) noexcept;
+    template const Kernels<UInt64 > *get_kernels<UInt64 >(EInstructionSet) noexcept;
+    template const Kernels<Float32> *get_kernels<Float32>(EInstructionSet) noexcept;
+    template const Kernels<Float64> *get_kernels<Float64>(EInstructionSet) noexcept;
+}
\ No newline at end of file
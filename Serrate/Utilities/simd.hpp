@@ -0,0 +1,125 @@
+#pragma once
+#include "types.hpp"
+
+#include <type_traits>
+
+// Bulk kernels over arithmetic spans. Kernels are compiled once per instruction set (simd.cpp for
+// scalar loops and baseline SSE2, simd_avx2.cpp for AVX2) and first call picks the widest one CPU supports.
+namespace Simd
+{
+    // Exactly the element types kernels are instantiated for in simd.cpp and simd_avx2.cpp. Other arithmetic
+    // types (WChar, Char8, Char16, Char32, long double and whichever of long or long long is not Int64)
+    // are left to scalar paths of callers
+    template <typename Type>
+    concept Arithmetic = std::is_same_v<Type, Char>
+                      || std::is_same_v<Type, Int8>    || std::is_same_v<Type, UInt8>
+                      || std::is_same_v<Type, Int16>   || std::is_same_v<Type, UInt16>
+                      || std::is_same_v<Type, Int32>   || std::is_same_v<Type, UInt32>
+                      || std::is_same_v<Type, Int64>   || std::is_same_v<Type, UInt64>
+                      || std::is_same_v<Type, Float32> || std::is_same_v<Type, Float64>;
+
+    // Integers are summed in 64 bits, floating point values in their own type
+    template <Arithmetic Type>
+    using SumType = std::conditional_t<std::is_floating_point_v<Type>, Type,
+                                       std::conditional_t<std::is_signed_v<Type>, Int64, UInt64>>;
+
+    template <Arithmetic Type>
+    struct Kernels
+    {
+        USize         (*find)(const Type *data, USize count, Type value) noexcept;
+        USize         (*count)(const Type *data, USize count, Type value) noexcept;
+        Type          (*min)(const Type *data, USize count) noexcept;
+        Type          (*max)(const Type *data, USize count) noexcept;
+        SumType<Type> (*sum)(const Type *data, USize count) noexcept;
+        Void          (*fill)(Type *data, USize count, Type value) noexcept;
+        USize         (*compare)(const Type *left, const Type *right, USize count) noexcept;
+        USize         (*replace_all)(Type *data, USize count, Type oldValue, Type newValue) noexcept;
+    };
+
+    enum class EInstructionSet
+    {
+        Scalar,
+        Sse2,
+        Avx2,
+    };
+
+    [[nodiscard]]
+    EInstructionSet get_instruction_set() noexcept;
+
+    // Table for best instruction set, resolved on first call
+    template <Arithmetic Type>
+    [[nodiscard]]
+    const Kernels<Type> &get_kernels() noexcept;
+
+    // Table for given instruction set (Scalar is plain loops), nullptr when CPU does not support it.
+    // Meant for benchmarks and tests comparing instruction sets
+    template <Arithmetic Type>
+    [[nodiscard]]
+    const Kernels<Type> *get_kernels(EInstructionSet instructionSet) noexcept;
+
+    // Index of first element equal to value or ~USize(0)
+    template <Arithmetic Type>
+    [[nodiscard]]
+    USize find(const Type *data, const USize count, const Type value) noexcept
+    {
+        return get_kernels<Type>().find(data, count, value);
+    }
+
+    template <Arithmetic Type>
+    [[nodiscard]]
+    Bool contains(const Type *data, const USize count, const Type value) noexcept
+    {
+        return find(data, count, value) != ~USize(0);
+    }
+
+    template <Arithmetic Type>
+    [[nodiscard]]
+    USize count(const Type *data, const USize count, const Type value) noexcept
+    {
+        return get_kernels<Type>().count(data, count, value);
+    }
+
+    // With NaN in floating point span result is unspecified
+    template <Arithmetic Type>
+    [[nodiscard]]
+    Type min(const Type *data, const USize count) noexcept
+    {
+        return get_kernels<Type>().min(data, count);
+    }
+
+    template <Arithmetic Type>
+    [[nodiscard]]
+    Type max(const Type *data, const USize count) noexcept
+    {
+        return get_kernels<Type>().max(data, count);
+    }
+
+    // Floating point sum is accumulated in vector lanes, so result can differ from sequential sum in last bits
+    template <Arithmetic Type>
+    [[nodiscard]]
+    SumType<Type> sum(const Type *data, const USize count) noexcept
+    {
+        return get_kernels<Type>().sum(data, count);
+    }
+
+    template <Arithmetic Type>
+    Void fill(Type *data, const USize count, const Type value) noexcept
+    {
+        get_kernels<Type>().fill(data, count, value);
+    }
+
+    // Index of first element which differs or ~USize(0) when both spans are equal
+    template <Arithmetic Type>
+    [[nodiscard]]
+    USize compare(const Type *left, const Type *right, const USize count) noexcept
+    {
+        return get_kernels<Type>().compare(left, right, count);
+    }
+
+    // Returns number of replaced elements
+    template <Arithmetic Type>
+    USize replace_all(Type *data, const USize count, const Type oldValue, const Type newValue) noexcept
+    {
+        return get_kernels<Type>().replace_all(data, count, oldValue, newValue);
+    }
+}
\ No newline at end of file
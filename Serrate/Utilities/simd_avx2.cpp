@@ -0,0 +1,36 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt), so it includes nothing that other files could share
+// as inline code, otherwise linker could pick AVX2 version of it for code running on older CPUs
+#include "simd.hpp"
+
+#include <cassert>
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+#define SIMD_KERNEL_NAMESPACE Simd::Avx2
+#define SIMD_KERNEL_WIDTH 32
+#include "simd_kernels.inl"
+#undef SIMD_KERNEL_NAMESPACE
+#undef SIMD_KERNEL_WIDTH
+
+namespace Simd::Avx2
+{
+    template <Arithmetic Type>
+    const Kernels<Type> &get_kernels() noexcept
+    {
+        return KERNELS<Type>;
+    }
+
+    template const Kernels<Char   > &get_kernels<Char   >() noexcept;
+    template const Kernels<Int8   > &get_kernels<Int8   >() noexcept;
+    template const Kernels<UInt8  > &get_kernels<UInt8  >() noexcept;
+    template const Kernels<Int16  > &get_kernels<Int16  >() noexcept;
+    template const Kernels<UInt16 > &get_kernels<UInt16 >() noexcept;
+    template const Kernels<Int32  > &get_kernels<Int32  >() noexcept;
+    template const Kernels<UInt32 > &get_kernels<UInt32 >() noexcept;
+    template const Kernels<Int64  > &get_kernels<Int64  >() noexcept;
+    template const Kernels<UInt64 > &get_kernels<UInt64 >() noexcept;
+    template const Kernels<Float32> &get_kernels<Float32>() noexcept;
+    template const Kernels<Float64> &get_kernels<Float64>() noexcept;
+}
+
+#endif
\ No newline at end of file
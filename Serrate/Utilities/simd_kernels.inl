@@ -0,0 +1,773 @@
+// Kernel bodies shared by simd.cpp and simd_avx2.cpp. Includer defines SIMD_KERNEL_NAMESPACE and
+// SIMD_KERNEL_WIDTH (vector width in bytes: 16 for SSE2, 32 for AVX2, 0 for scalar only) and compiles this
+// file with matching instruction set. Vector primitives keep every element type in integer registers,
+// floating point lanes are reinterpreted only for compares, min, max and sums. Kernels run whole vectors
+// and finish remaining elements with scalar loop. Std function templates (std::min, std::countr_zero...)
+// are not used here, their copies instantiated in AVX2 file could be picked by linker for other files.
+
+#include <cstring>
+
+#if SIMD_KERNEL_WIDTH > 0
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+namespace SIMD_KERNEL_NAMESPACE
+{
+#if SIMD_KERNEL_WIDTH > 0
+    template <typename Type>
+    constexpr USize LANES = SIMD_KERNEL_WIDTH / sizeof(Type);
+
+    // Byte counters of count and replace_all are flushed before they can wrap
+    constexpr USize MAX_COUNTER_VECTORS = 255;
+
+    template <typename Type>
+    constexpr Bool IS_SIGNED = Type(-1) < Type(0);
+
+    // Integer of the same size, used to splat floating point bits
+    template <typename Type>
+    using Bits = std::conditional_t<sizeof(Type) == 1, Int8,
+                 std::conditional_t<sizeof(Type) == 2, Int16,
+                 std::conditional_t<sizeof(Type) == 4, Int32, Int64>>>;
+
+    template <typename Type>
+    Bits<Type> to_bits(const Type value) noexcept
+    {
+        Bits<Type> result;
+        memcpy(&result, &value, sizeof(Type));
+        return result;
+    }
+
+    inline UInt32 get_first_bit(const UInt32 mask) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return UInt32(index);
+#else
+        return UInt32(__builtin_ctz(mask));
+#endif
+    }
+#endif
+
+#if SIMD_KERNEL_WIDTH == 16
+    namespace Vector
+    {
+        using Register = __m128i;
+
+        constexpr UInt32 FULL_MASK = 0xFFFF;
+
+        inline Register zero() noexcept
+        {
+            return _mm_setzero_si128();
+        }
+
+        template <typename Type>
+        Register load(const Type *source) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const Register *>(source));
+        }
+
+        template <typename Type>
+        Void store(Type *target, const Register value) noexcept
+        {
+            _mm_storeu_si128(reinterpret_cast<Register *>(target), value);
+        }
+
+        template <typename Type>
+        Register splat(const Type value) noexcept
+        {
+            if constexpr (sizeof(Type) == 1)
+            {
+                return _mm_set1_epi8(to_bits(value));
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                return _mm_set1_epi16(to_bits(value));
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return _mm_set1_epi32(to_bits(value));
+            } else {
+                return _mm_set1_epi64x(to_bits(value));
+            }
+        }
+
+        // One bit per byte, lanes of mask are all ones or all zeros
+        inline UInt32 get_byte_mask(const Register mask) noexcept
+        {
+            return UInt32(_mm_movemask_epi8(mask));
+        }
+
+        inline Register select(const Register mask, const Register ifTrue, const Register ifFalse) noexcept
+        {
+            return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+        }
+
+        inline Register subtract_bytes(const Register left, const Register right) noexcept
+        {
+            return _mm_sub_epi8(left, right);
+        }
+
+        inline UInt64 sum_bytes(const Register value) noexcept
+        {
+            const Register sums = _mm_sad_epu8(value, zero());
+            return UInt64(_mm_cvtsi128_si64(sums)) + UInt64(_mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+        }
+
+        template <typename Type>
+        Register equal(const Register left, const Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+            }
+            else if constexpr (sizeof(Type) == 1)
+            {
+                return _mm_cmpeq_epi8(left, right);
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                return _mm_cmpeq_epi16(left, right);
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return _mm_cmpeq_epi32(left, right);
+            } else {
+                // SSE2 has no 64 bit compare, both halves have to match
+                const Register halves = _mm_cmpeq_epi32(left, right);
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        }
+
+        // Lanes where left < right
+        template <typename Type>
+        Register less(Register left, Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm_castps_si128(_mm_cmplt_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm_castpd_si128(_mm_cmplt_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+            } else {
+                // Unsigned order is signed order with flipped sign bits
+                if constexpr (!IS_SIGNED<Type>)
+                {
+                    const Register sign = splat(Bits<Type>(Bits<Type>(1) << (sizeof(Type) * 8 - 1)));
+                    left = _mm_xor_si128(left, sign);
+                    right = _mm_xor_si128(right, sign);
+                }
+
+                if constexpr (sizeof(Type) == 1)
+                {
+                    return _mm_cmplt_epi8(left, right);
+                }
+                else if constexpr (sizeof(Type) == 2)
+                {
+                    return _mm_cmplt_epi16(left, right);
+                }
+                else if constexpr (sizeof(Type) == 4)
+                {
+                    return _mm_cmplt_epi32(left, right);
+                } else {
+                    // High halves decide as signed, equal high halves fall back to low halves as unsigned
+                    const Register lowSign = _mm_set1_epi64x(0x80000000);
+                    const Register highLess = _mm_cmplt_epi32(left, right);
+                    const Register highEqual = _mm_cmpeq_epi32(left, right);
+                    const Register lowLess = _mm_cmplt_epi32(_mm_xor_si128(left, lowSign), _mm_xor_si128(right, lowSign));
+                    return _mm_or_si128(_mm_shuffle_epi32(highLess, _MM_SHUFFLE(3, 3, 1, 1)),
+                                        _mm_and_si128(_mm_shuffle_epi32(highEqual, _MM_SHUFFLE(3, 3, 1, 1)),
+                                                      _mm_shuffle_epi32(lowLess, _MM_SHUFFLE(2, 2, 0, 0))));
+                }
+            }
+        }
+
+        // left < right ? left : right
+        template <typename Type>
+        Register min(const Register left, const Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm_castpd_si128(_mm_min_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+            }
+            else if constexpr (sizeof(Type) == 1 && !IS_SIGNED<Type>)
+            {
+                return _mm_min_epu8(left, right);
+            }
+            else if constexpr (sizeof(Type) == 2 && IS_SIGNED<Type>)
+            {
+                return _mm_min_epi16(left, right);
+            } else {
+                return select(less<Type>(left, right), left, right);
+            }
+        }
+
+        // right < left ? left : right
+        template <typename Type>
+        Register max(const Register left, const Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm_castpd_si128(_mm_max_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+            }
+            else if constexpr (sizeof(Type) == 1 && !IS_SIGNED<Type>)
+            {
+                return _mm_max_epu8(left, right);
+            }
+            else if constexpr (sizeof(Type) == 2 && IS_SIGNED<Type>)
+            {
+                return _mm_max_epi16(left, right);
+            } else {
+                return select(less<Type>(right, left), left, right);
+            }
+        }
+
+        // 32 bit lanes are widened to 64 bits and added into 64 bit lanes of sum
+        template <Bool IsSigned>
+        Register add_widened(const Register sum, const Register value) noexcept
+        {
+            const Register high = IsSigned ? _mm_cmplt_epi32(value, zero()) : zero();
+            return _mm_add_epi64(sum, _mm_add_epi64(_mm_unpacklo_epi32(value, high), _mm_unpackhi_epi32(value, high)));
+        }
+
+        // Integers are added into 64 bit lanes, floating point values into lanes of their own type
+        template <typename Type>
+        Register accumulate(const Register sum, const Register value) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(sum), _mm_castsi128_ps(value)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm_castpd_si128(_mm_add_pd(_mm_castsi128_pd(sum), _mm_castsi128_pd(value)));
+            }
+            else if constexpr (sizeof(Type) == 1)
+            {
+                // Signed bytes are biased to unsigned ones and 8 * 128 is taken back from every lane
+                if constexpr (IS_SIGNED<Type>)
+                {
+                    const Register biased = _mm_sad_epu8(_mm_xor_si128(value, _mm_set1_epi8(-128)), zero());
+                    return _mm_add_epi64(sum, _mm_sub_epi64(biased, _mm_set1_epi64x(8 * 128)));
+                } else {
+                    return _mm_add_epi64(sum, _mm_sad_epu8(value, zero()));
+                }
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                if constexpr (IS_SIGNED<Type>)
+                {
+                    return add_widened<true>(sum, _mm_madd_epi16(value, _mm_set1_epi16(1)));
+                } else {
+                    const Register pairs = _mm_add_epi32(_mm_unpacklo_epi16(value, zero()),
+                                                         _mm_unpackhi_epi16(value, zero()));
+                    return add_widened<false>(sum, pairs);
+                }
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return add_widened<IS_SIGNED<Type>>(sum, value);
+            } else {
+                return _mm_add_epi64(sum, value);
+            }
+        }
+    }
+#elif SIMD_KERNEL_WIDTH == 32
+    namespace Vector
+    {
+        using Register = __m256i;
+
+        constexpr UInt32 FULL_MASK = 0xFFFFFFFF;
+
+        inline Register zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        template <typename Type>
+        Register load(const Type *source) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const Register *>(source));
+        }
+
+        template <typename Type>
+        Void store(Type *target, const Register value) noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<Register *>(target), value);
+        }
+
+        template <typename Type>
+        Register splat(const Type value) noexcept
+        {
+            if constexpr (sizeof(Type) == 1)
+            {
+                return _mm256_set1_epi8(to_bits(value));
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                return _mm256_set1_epi16(to_bits(value));
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return _mm256_set1_epi32(to_bits(value));
+            } else {
+                return _mm256_set1_epi64x(to_bits(value));
+            }
+        }
+
+        // One bit per byte, lanes of mask are all ones or all zeros
+        inline UInt32 get_byte_mask(const Register mask) noexcept
+        {
+            return UInt32(_mm256_movemask_epi8(mask));
+        }
+
+        inline Register select(const Register mask, const Register ifTrue, const Register ifFalse) noexcept
+        {
+            return _mm256_blendv_epi8(ifFalse, ifTrue, mask);
+        }
+
+        inline Register subtract_bytes(const Register left, const Register right) noexcept
+        {
+            return _mm256_sub_epi8(left, right);
+        }
+
+        inline UInt64 sum_bytes(const Register value) noexcept
+        {
+            const Register sums = _mm256_sad_epu8(value, zero());
+            const __m128i halves = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+            return UInt64(_mm_cvtsi128_si64(halves)) + UInt64(_mm_cvtsi128_si64(_mm_unpackhi_epi64(halves, halves)));
+        }
+
+        template <typename Type>
+        Register equal(const Register left, const Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right),
+                                                         _CMP_EQ_OQ));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right),
+                                                         _CMP_EQ_OQ));
+            }
+            else if constexpr (sizeof(Type) == 1)
+            {
+                return _mm256_cmpeq_epi8(left, right);
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                return _mm256_cmpeq_epi16(left, right);
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return _mm256_cmpeq_epi32(left, right);
+            } else {
+                return _mm256_cmpeq_epi64(left, right);
+            }
+        }
+
+        // Lanes where left < right
+        template <typename Type>
+        Register less(Register left, Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right),
+                                                         _CMP_LT_OQ));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right),
+                                                         _CMP_LT_OQ));
+            } else {
+                // Unsigned order is signed order with flipped sign bits
+                if constexpr (!IS_SIGNED<Type>)
+                {
+                    const Register sign = splat(Bits<Type>(Bits<Type>(1) << (sizeof(Type) * 8 - 1)));
+                    left = _mm256_xor_si256(left, sign);
+                    right = _mm256_xor_si256(right, sign);
+                }
+
+                if constexpr (sizeof(Type) == 1)
+                {
+                    return _mm256_cmpgt_epi8(right, left);
+                }
+                else if constexpr (sizeof(Type) == 2)
+                {
+                    return _mm256_cmpgt_epi16(right, left);
+                }
+                else if constexpr (sizeof(Type) == 4)
+                {
+                    return _mm256_cmpgt_epi32(right, left);
+                } else {
+                    return _mm256_cmpgt_epi64(right, left);
+                }
+            }
+        }
+
+        // left < right ? left : right
+        template <typename Type>
+        Register min(const Register left, const Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right)));
+            }
+            else if constexpr (sizeof(Type) == 1)
+            {
+                return IS_SIGNED<Type> ? _mm256_min_epi8(left, right) : _mm256_min_epu8(left, right);
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                return IS_SIGNED<Type> ? _mm256_min_epi16(left, right) : _mm256_min_epu16(left, right);
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return IS_SIGNED<Type> ? _mm256_min_epi32(left, right) : _mm256_min_epu32(left, right);
+            } else {
+                return select(less<Type>(left, right), left, right);
+            }
+        }
+
+        // right < left ? left : right
+        template <typename Type>
+        Register max(const Register left, const Register right) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right)));
+            }
+            else if constexpr (sizeof(Type) == 1)
+            {
+                return IS_SIGNED<Type> ? _mm256_max_epi8(left, right) : _mm256_max_epu8(left, right);
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                return IS_SIGNED<Type> ? _mm256_max_epi16(left, right) : _mm256_max_epu16(left, right);
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return IS_SIGNED<Type> ? _mm256_max_epi32(left, right) : _mm256_max_epu32(left, right);
+            } else {
+                return select(less<Type>(right, left), left, right);
+            }
+        }
+
+        // 32 bit lanes are widened to 64 bits and added into 64 bit lanes of sum
+        template <Bool IsSigned>
+        Register add_widened(const Register sum, const Register value) noexcept
+        {
+            const Register high = IsSigned ? _mm256_cmpgt_epi32(zero(), value) : zero();
+            return _mm256_add_epi64(sum, _mm256_add_epi64(_mm256_unpacklo_epi32(value, high),
+                                                          _mm256_unpackhi_epi32(value, high)));
+        }
+
+        // Integers are added into 64 bit lanes, floating point values into lanes of their own type
+        template <typename Type>
+        Register accumulate(const Register sum, const Register value) noexcept
+        {
+            if constexpr (std::is_same_v<Type, Float32>)
+            {
+                return _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(sum), _mm256_castsi256_ps(value)));
+            }
+            else if constexpr (std::is_same_v<Type, Float64>)
+            {
+                return _mm256_castpd_si256(_mm256_add_pd(_mm256_castsi256_pd(sum), _mm256_castsi256_pd(value)));
+            }
+            else if constexpr (sizeof(Type) == 1)
+            {
+                // Signed bytes are biased to unsigned ones and 8 * 128 is taken back from every lane
+                if constexpr (IS_SIGNED<Type>)
+                {
+                    const Register biased = _mm256_sad_epu8(_mm256_xor_si256(value, _mm256_set1_epi8(-128)), zero());
+                    return _mm256_add_epi64(sum, _mm256_sub_epi64(biased, _mm256_set1_epi64x(8 * 128)));
+                } else {
+                    return _mm256_add_epi64(sum, _mm256_sad_epu8(value, zero()));
+                }
+            }
+            else if constexpr (sizeof(Type) == 2)
+            {
+                if constexpr (IS_SIGNED<Type>)
+                {
+                    return add_widened<true>(sum, _mm256_madd_epi16(value, _mm256_set1_epi16(1)));
+                } else {
+                    const Register pairs = _mm256_add_epi32(_mm256_unpacklo_epi16(value, zero()),
+                                                            _mm256_unpackhi_epi16(value, zero()));
+                    return add_widened<false>(sum, pairs);
+                }
+            }
+            else if constexpr (sizeof(Type) == 4)
+            {
+                return add_widened<IS_SIGNED<Type>>(sum, value);
+            } else {
+                return _mm256_add_epi64(sum, value);
+            }
+        }
+    }
+#endif
+
+    template <typename Type>
+    USize find(const Type *data, const USize count, const Type value) noexcept
+    {
+        USize i = 0;
+#if SIMD_KERNEL_WIDTH > 0
+        const Vector::Register needle = Vector::splat(value);
+        for (; i + LANES<Type> <= count; i += LANES<Type>)
+        {
+            const UInt32 matches = Vector::get_byte_mask(Vector::equal<Type>(Vector::load(data + i), needle));
+            if (matches)
+            {
+                return i + get_first_bit(matches) / sizeof(Type);
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            if (data[i] == value)
+            {
+                return i;
+            }
+        }
+        return ~USize(0);
+    }
+
+    template <typename Type>
+    USize count(const Type *data, const USize count, const Type value) noexcept
+    {
+        USize result = 0;
+        USize i = 0;
+#if SIMD_KERNEL_WIDTH > 0
+        // Every byte of matching lane adds one to its byte counter, totals are divided by element size
+        const Vector::Register needle = Vector::splat(value);
+        const USize vectorEnd = count - count % LANES<Type>;
+        while (i < vectorEnd)
+        {
+            const USize blockEnd = vectorEnd - i > MAX_COUNTER_VECTORS * LANES<Type>
+                                 ? i + MAX_COUNTER_VECTORS * LANES<Type>
+                                 : vectorEnd;
+            Vector::Register counters = Vector::zero();
+            for (; i < blockEnd; i += LANES<Type>)
+            {
+                counters = Vector::subtract_bytes(counters, Vector::equal<Type>(Vector::load(data + i), needle));
+            }
+            result += USize(Vector::sum_bytes(counters)) / sizeof(Type);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            result += USize(data[i] == value);
+        }
+        return result;
+    }
+
+    template <typename Type>
+    Type min(const Type *data, const USize count) noexcept
+    {
+        assert(data && count > 0 && "Span is empty!");
+        Type result = data[0];
+        USize i = 1;
+#if SIMD_KERNEL_WIDTH > 0
+        if (count >= LANES<Type>)
+        {
+            Vector::Register lanes = Vector::load(data);
+            for (i = LANES<Type>; i + LANES<Type> <= count; i += LANES<Type>)
+            {
+                lanes = Vector::min<Type>(Vector::load(data + i), lanes);
+            }
+
+            Type lane[LANES<Type>];
+            Vector::store(lane, lanes);
+            result = lane[0];
+            for (USize j = 1; j < LANES<Type>; ++j)
+            {
+                result = lane[j] < result ? lane[j] : result;
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            result = data[i] < result ? data[i] : result;
+        }
+        return result;
+    }
+
+    template <typename Type>
+    Type max(const Type *data, const USize count) noexcept
+    {
+        assert(data && count > 0 && "Span is empty!");
+        Type result = data[0];
+        USize i = 1;
+#if SIMD_KERNEL_WIDTH > 0
+        if (count >= LANES<Type>)
+        {
+            Vector::Register lanes = Vector::load(data);
+            for (i = LANES<Type>; i + LANES<Type> <= count; i += LANES<Type>)
+            {
+                lanes = Vector::max<Type>(Vector::load(data + i), lanes);
+            }
+
+            Type lane[LANES<Type>];
+            Vector::store(lane, lanes);
+            result = lane[0];
+            for (USize j = 1; j < LANES<Type>; ++j)
+            {
+                result = result < lane[j] ? lane[j] : result;
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            result = result < data[i] ? data[i] : result;
+        }
+        return result;
+    }
+
+    template <typename Type>
+    Simd::SumType<Type> sum(const Type *data, const USize count) noexcept
+    {
+        using Sum = Simd::SumType<Type>;
+        Sum result = 0;
+        USize i = 0;
+#if SIMD_KERNEL_WIDTH > 0
+        Vector::Register sums = Vector::zero();
+        for (; i + LANES<Type> <= count; i += LANES<Type>)
+        {
+            sums = Vector::accumulate<Type>(sums, Vector::load(data + i));
+        }
+
+        Sum lane[LANES<Sum>];
+        Vector::store(lane, sums);
+        for (USize j = 0; j < LANES<Sum>; ++j)
+        {
+            result += lane[j];
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            result += Sum(data[i]);
+        }
+        return result;
+    }
+
+    template <typename Type>
+    Void fill(Type *data, const USize count, const Type value) noexcept
+    {
+        USize i = 0;
+#if SIMD_KERNEL_WIDTH > 0
+        const Vector::Register filler = Vector::splat(value);
+        for (; i + LANES<Type> <= count; i += LANES<Type>)
+        {
+            Vector::store(data + i, filler);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            data[i] = value;
+        }
+    }
+
+    template <typename Type>
+    USize compare(const Type *left, const Type *right, const USize count) noexcept
+    {
+        USize i = 0;
+#if SIMD_KERNEL_WIDTH > 0
+        for (; i + LANES<Type> <= count; i += LANES<Type>)
+        {
+            const Vector::Register equal = Vector::equal<Type>(Vector::load(left + i), Vector::load(right + i));
+            const UInt32 differences = Vector::get_byte_mask(equal) ^ Vector::FULL_MASK;
+            if (differences)
+            {
+                return i + get_first_bit(differences) / sizeof(Type);
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            if (left[i] != right[i])
+            {
+                return i;
+            }
+        }
+        return ~USize(0);
+    }
+
+    template <typename Type>
+    USize replace_all(Type *data, const USize count, const Type oldValue, const Type newValue) noexcept
+    {
+        USize result = 0;
+        USize i = 0;
+#if SIMD_KERNEL_WIDTH > 0
+        const Vector::Register oldValues = Vector::splat(oldValue);
+        const Vector::Register newValues = Vector::splat(newValue);
+        const USize vectorEnd = count - count % LANES<Type>;
+        while (i < vectorEnd)
+        {
+            const USize blockEnd = vectorEnd - i > MAX_COUNTER_VECTORS * LANES<Type>
+                                 ? i + MAX_COUNTER_VECTORS * LANES<Type>
+                                 : vectorEnd;
+            Vector::Register counters = Vector::zero();
+            for (; i < blockEnd; i += LANES<Type>)
+            {
+                const Vector::Register current = Vector::load(data + i);
+                const Vector::Register matches = Vector::equal<Type>(current, oldValues);
+                counters = Vector::subtract_bytes(counters, matches);
+                Vector::store(data + i, Vector::select(matches, newValues, current));
+            }
+            result += USize(Vector::sum_bytes(counters)) / sizeof(Type);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            const Bool isMatch = data[i] == oldValue;
+            result += USize(isMatch);
+            data[i] = isMatch ? newValue : data[i];
+        }
+        return result;
+    }
+
+    template <typename Type>
+    constexpr Simd::Kernels<Type> KERNELS =
+    {
+        .find        = find<Type>,
+        .count       = count<Type>,
+        .min         = min<Type>,
+        .max         = max<Type>,
+        .sum         = sum<Type>,
+        .fill        = fill<Type>,
+        .compare     = compare<Type>,
+        .replace_all = replace_all<Type>,
+    };
+}
\ No newline at end of file
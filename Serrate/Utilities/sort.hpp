@@ -0,0 +1,624 @@
+#pragma once
+#include "types.hpp"
+#include "Serrate/Memory/memory_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+// Sorting in place over contiguous storage (DynamicArray, Array, SmallArray, raw pointers). Elements are
+// moved with the same rules as containers use: relocatable ones by plain copy of bytes, pinned ones by
+// move(), copy() and finalize(), so every element ends up in exactly one slot.
+namespace Sort
+{
+    struct Less
+    {
+        template <typename Left, typename Right>
+        Bool operator()(const Left &left, const Right &right) const noexcept
+        {
+            return left < right;
+        }
+    };
+
+    struct Greater
+    {
+        template <typename Left, typename Right>
+        Bool operator()(const Left &left, const Right &right) const noexcept
+        {
+            return right < left;
+        }
+    };
+
+    template <typename Type>
+    concept RadixKey = (std::is_integral_v<Type> || std::is_floating_point_v<Type>) && !std::is_same_v<Type, Bool>;
+
+    // Largest count network_sort accepts
+    constexpr USize MAX_NETWORK_SIZE = 8;
+
+    namespace Detail
+    {
+        constexpr USize INSERTION_SORT_THRESHOLD     = 24;
+        constexpr USize NINTHER_THRESHOLD            = 128;
+        constexpr USize PARTIAL_INSERTION_SORT_LIMIT = 8;
+        constexpr USize STABLE_RUN_SIZE              = 32;
+        constexpr USize RADIX_THRESHOLD              = 64;
+
+        // Size optimal networks, pairs of indices compared and exchanged in order
+        constexpr UInt8 NETWORK_2[][2] = { {0, 1} };
+        constexpr UInt8 NETWORK_3[][2] = { {0, 2}, {0, 1}, {1, 2} };
+        constexpr UInt8 NETWORK_4[][2] = { {0, 2}, {1, 3}, {0, 1}, {2, 3}, {1, 2} };
+        constexpr UInt8 NETWORK_5[][2] = { {0, 3}, {1, 4}, {0, 2}, {1, 3}, {0, 1}, {2, 4}, {1, 2}, {3, 4}, {2, 3} };
+        constexpr UInt8 NETWORK_6[][2] = { {0, 5}, {1, 3}, {2, 4}, {1, 2}, {3, 4}, {0, 3}, {2, 5}, {0, 1}, {2, 3},
+                                           {4, 5}, {1, 2}, {3, 4} };
+        constexpr UInt8 NETWORK_7[][2] = { {0, 6}, {2, 3}, {4, 5}, {0, 2}, {1, 4}, {3, 6}, {0, 1}, {2, 5}, {3, 4},
+                                           {1, 2}, {4, 6}, {2, 3}, {4, 5}, {1, 2}, {3, 4}, {5, 6} };
+        constexpr UInt8 NETWORK_8[][2] = { {0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1},
+                                           {2, 3}, {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4},
+                                           {5, 6} };
+
+        // Compare and select compiles to conditional moves only for scalars
+        template <typename Type>
+        constexpr Bool IS_BRANCHLESS = std::is_arithmetic_v<Type> || std::is_pointer_v<Type> || std::is_enum_v<Type>;
+
+        template <Manual Type>
+        Void relocate(Type &target, Type &source) noexcept
+        {
+            if constexpr (Relocatable<Type>)
+            {
+                target = source;
+            }
+            else if constexpr (Moveable<Type>)
+            {
+                target.move(source);
+            }
+            else if constexpr (Copyable<Type>)
+            {
+                target.copy(source);
+                if constexpr (Finalizable<Type>)
+                {
+                    source.finalize();
+                }
+            } else {
+                target = source;
+            }
+        }
+
+        template <Manual Type>
+        Void swap_elements(Type &left, Type &right) noexcept
+        {
+            Type temporary{};
+            relocate(temporary, left);
+            relocate(left, right);
+            relocate(right, temporary);
+        }
+
+        template <Manual Type, typename Compare>
+        Void compare_swap(Type &left, Type &right, Compare &compare) noexcept
+        {
+            if constexpr (IS_BRANCHLESS<Type>)
+            {
+                const Type first = left;
+                const Type second = right;
+                const Bool isSwapped = compare(second, first);
+                left = isSwapped ? second : first;
+                right = isSwapped ? first : second;
+            }
+            else if (compare(right, left))
+            {
+                swap_elements(left, right);
+            }
+        }
+
+        template <Manual Type, typename Compare, USize PairCount>
+        Void run_network(Type *data, const UInt8 (&pairs)[PairCount][2], Compare &compare) noexcept
+        {
+            for (USize i = 0; i < PairCount; ++i)
+            {
+                compare_swap(data[pairs[i][0]], data[pairs[i][1]], compare);
+            }
+        }
+
+        template <Manual Type, typename Compare>
+        Void sort_network(Type *data, const USize count, Compare &compare) noexcept
+        {
+            switch (count)
+            {
+                case 2: run_network(data, NETWORK_2, compare); break;
+                case 3: run_network(data, NETWORK_3, compare); break;
+                case 4: run_network(data, NETWORK_4, compare); break;
+                case 5: run_network(data, NETWORK_5, compare); break;
+                case 6: run_network(data, NETWORK_6, compare); break;
+                case 7: run_network(data, NETWORK_7, compare); break;
+                case 8: run_network(data, NETWORK_8, compare); break;
+                default: break;
+            }
+        }
+
+        // Stable, Guarded has to be true unless element before begin is not greater than any in range
+        template <Bool Guarded, Manual Type, typename Compare>
+        Void insertion_sort(Type *begin, Type *end, Compare &compare) noexcept
+        {
+            if (begin == end)
+            {
+                return;
+            }
+
+            for (Type *current = begin + 1; current != end; ++current)
+            {
+                if (compare(*current, *(current - 1)))
+                {
+                    Type temporary{};
+                    relocate(temporary, *current);
+                    Type *hole = current;
+                    do
+                    {
+                        relocate(*hole, *(hole - 1));
+                        --hole;
+                    } while ((!Guarded || hole != begin) && compare(temporary, *(hole - 1)));
+                    relocate(*hole, temporary);
+                }
+            }
+        }
+
+        // Gives up after PARTIAL_INSERTION_SORT_LIMIT moved elements, returns true when range got sorted
+        template <Manual Type, typename Compare>
+        Bool partial_insertion_sort(Type *begin, Type *end, Compare &compare) noexcept
+        {
+            if (begin == end)
+            {
+                return true;
+            }
+
+            USize moveCount = 0;
+            for (Type *current = begin + 1; current != end; ++current)
+            {
+                if (compare(*current, *(current - 1)))
+                {
+                    Type temporary{};
+                    relocate(temporary, *current);
+                    Type *hole = current;
+                    do
+                    {
+                        relocate(*hole, *(hole - 1));
+                        --hole;
+                    } while (hole != begin && compare(temporary, *(hole - 1)));
+                    relocate(*hole, temporary);
+                    moveCount += USize(current - hole);
+                }
+
+                if (moveCount > PARTIAL_INSERTION_SORT_LIMIT)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <Manual Type, typename Compare>
+        Void sift_down(Type *data, USize index, const USize count, Compare &compare) noexcept
+        {
+            Type temporary{};
+            relocate(temporary, data[index]);
+            while (true)
+            {
+                USize child = 2 * index + 1;
+                if (child >= count)
+                {
+                    break;
+                }
+                if (child + 1 < count && compare(data[child], data[child + 1]))
+                {
+                    ++child;
+                }
+                if (!compare(temporary, data[child]))
+                {
+                    break;
+                }
+                relocate(data[index], data[child]);
+                index = child;
+            }
+            relocate(data[index], temporary);
+        }
+
+        template <Manual Type, typename Compare>
+        Void heap_sort(Type *data, const USize count, Compare &compare) noexcept
+        {
+            for (USize i = count / 2; i-- > 0;)
+            {
+                sift_down(data, i, count, compare);
+            }
+            for (USize last = count; last-- > 1;)
+            {
+                swap_elements(data[0], data[last]);
+                sift_down(data, 0, last, compare);
+            }
+        }
+
+        template <Manual Type, typename Compare>
+        Void sort3(Type &first, Type &second, Type &third, Compare &compare) noexcept
+        {
+            compare_swap(first, second, compare);
+            compare_swap(second, third, compare);
+            compare_swap(first, second, compare);
+        }
+
+        struct PartitionResult
+        {
+            USize pivotIndex;
+            Bool  isAlreadyPartitioned;
+        };
+
+        // Pivot is *begin, elements equal to pivot go right. Relies on median of 3 leaving element not less
+        // than pivot in range, so inner loops need no bounds checks.
+        template <Manual Type, typename Compare>
+        PartitionResult partition_right(Type *begin, Type *end, Compare &compare) noexcept
+        {
+            Type pivot{};
+            relocate(pivot, *begin);
+
+            Type *first = begin;
+            Type *last = end;
+            while (compare(*++first, pivot));
+
+            if (first - 1 == begin)
+            {
+                while (first < last && !compare(*--last, pivot));
+            } else {
+                while (!compare(*--last, pivot));
+            }
+
+            const Bool isAlreadyPartitioned = first >= last;
+            while (first < last)
+            {
+                swap_elements(*first, *last);
+                while (compare(*++first, pivot));
+                while (!compare(*--last, pivot));
+            }
+
+            Type *pivotPosition = first - 1;
+            relocate(*begin, *pivotPosition);
+            relocate(*pivotPosition, pivot);
+            return { USize(pivotPosition - begin), isAlreadyPartitioned };
+        }
+
+        // Used when pivot equals element before range, puts all elements equal to pivot left of it
+        template <Manual Type, typename Compare>
+        Type *partition_left(Type *begin, Type *end, Compare &compare) noexcept
+        {
+            Type pivot{};
+            relocate(pivot, *begin);
+
+            Type *first = begin;
+            Type *last = end;
+            while (compare(pivot, *--last));
+
+            if (last + 1 == end)
+            {
+                while (first < last && !compare(pivot, *++first));
+            } else {
+                while (!compare(pivot, *++first));
+            }
+
+            while (first < last)
+            {
+                swap_elements(*first, *last);
+                while (compare(pivot, *--last));
+                while (!compare(pivot, *++first));
+            }
+
+            relocate(*begin, *last);
+            relocate(*last, pivot);
+            return last;
+        }
+
+        // Swaps few elements after unbalanced partition so same pattern does not pick bad pivot again
+        template <Manual Type>
+        Void break_patterns(Type *begin, Type *end) noexcept
+        {
+            const USize size = USize(end - begin);
+            if (size < INSERTION_SORT_THRESHOLD)
+            {
+                return;
+            }
+
+            const USize quarter = size / 4;
+            swap_elements(begin[0], begin[quarter]);
+            swap_elements(end[-1], end[-SSize(quarter)]);
+            if (size > NINTHER_THRESHOLD)
+            {
+                swap_elements(begin[1], begin[quarter + 1]);
+                swap_elements(begin[2], begin[quarter + 2]);
+                swap_elements(end[-2], end[-SSize(quarter + 1)]);
+                swap_elements(end[-3], end[-SSize(quarter + 2)]);
+            }
+        }
+
+        template <Manual Type, typename Compare>
+        Void pdqsort(Type *begin, Type *end, Compare &compare, UInt32 badAllowed, Bool isLeftmost) noexcept
+        {
+            while (true)
+            {
+                const USize size = USize(end - begin);
+                if (size < INSERTION_SORT_THRESHOLD)
+                {
+                    if constexpr (IS_BRANCHLESS<Type>)
+                    {
+                        if (size <= MAX_NETWORK_SIZE)
+                        {
+                            sort_network(begin, size, compare);
+                            return;
+                        }
+                    }
+
+                    if (isLeftmost)
+                    {
+                        insertion_sort<true>(begin, end, compare);
+                    } else {
+                        insertion_sort<false>(begin, end, compare);
+                    }
+                    return;
+                }
+
+                // Median of 3 moved to begin, for big ranges pseudo median of 9
+                const USize half = size / 2;
+                if (size > NINTHER_THRESHOLD)
+                {
+                    sort3(begin[0], begin[half], end[-1], compare);
+                    sort3(begin[1], begin[half - 1], end[-2], compare);
+                    sort3(begin[2], begin[half + 1], end[-3], compare);
+                    sort3(begin[half - 1], begin[half], begin[half + 1], compare);
+                    swap_elements(begin[0], begin[half]);
+                } else {
+                    sort3(begin[half], begin[0], end[-1], compare);
+                }
+
+                // Pivot equal to element before range, everything equal to it is already in place
+                if (!isLeftmost && !compare(begin[-1], begin[0]))
+                {
+                    begin = partition_left(begin, end, compare) + 1;
+                    continue;
+                }
+
+                const PartitionResult partition = partition_right(begin, end, compare);
+                Type *pivot = begin + partition.pivotIndex;
+                const USize leftSize = partition.pivotIndex;
+                const USize rightSize = size - leftSize - 1;
+
+                if (leftSize < size / 8 || rightSize < size / 8)
+                {
+                    if (--badAllowed == 0)
+                    {
+                        heap_sort(begin, size, compare);
+                        return;
+                    }
+                    break_patterns(begin, pivot);
+                    break_patterns(pivot + 1, end);
+                }
+                else if (partition.isAlreadyPartitioned &&
+                         partial_insertion_sort(begin, pivot, compare) &&
+                         partial_insertion_sort(pivot + 1, end, compare))
+                {
+                    return;
+                }
+
+                // Recurse into left part, loop over right part
+                pdqsort(begin, pivot, compare, badAllowed, isLeftmost);
+                begin = pivot + 1;
+                isLeftmost = false;
+            }
+        }
+
+        // Stable merge of two sorted runs into target, on equal elements left run goes first
+        template <Manual Type, typename Compare>
+        Void merge(Type *left, Type *leftEnd, Type *right, Type *rightEnd, Type *target, Compare &compare) noexcept
+        {
+            // Runs already in order are only moved
+            if (left != leftEnd && right != rightEnd && compare(*right, *(leftEnd - 1)))
+            {
+                while (left != leftEnd && right != rightEnd)
+                {
+                    if (compare(*right, *left))
+                    {
+                        relocate(*target++, *right++);
+                    } else {
+                        relocate(*target++, *left++);
+                    }
+                }
+            }
+
+            while (left != leftEnd)
+            {
+                relocate(*target++, *left++);
+            }
+            while (right != rightEnd)
+            {
+                relocate(*target++, *right++);
+            }
+        }
+
+        // Buffer has to hold count elements, result ends in data
+        template <Manual Type, typename Compare>
+        Void merge_sort(Type *data, const USize count, Type *buffer, Compare &compare) noexcept
+        {
+            for (USize i = 0; i < count; i += STABLE_RUN_SIZE)
+            {
+                insertion_sort<true>(data + i, data + std::min(i + STABLE_RUN_SIZE, count), compare);
+            }
+
+            Type *source = data;
+            Type *target = buffer;
+            for (USize width = STABLE_RUN_SIZE; width < count; width *= 2)
+            {
+                for (USize begin = 0; begin < count; begin += 2 * width)
+                {
+                    const USize middle = std::min(begin + width, count);
+                    const USize end = std::min(begin + 2 * width, count);
+                    merge(source + begin, source + middle, source + middle, source + end, target + begin, compare);
+                }
+                std::swap(source, target);
+            }
+
+            if (source != data)
+            {
+                for (USize i = 0; i < count; ++i)
+                {
+                    relocate(data[i], source[i]);
+                }
+            }
+        }
+
+        // Maps key to unsigned integer with same order, negative floats have all bits flipped
+        template <RadixKey Key>
+        auto get_radix_bits(const Key key) noexcept
+        {
+            using Bits = std::conditional_t<sizeof(Key) == 1, UInt8,
+                         std::conditional_t<sizeof(Key) == 2, UInt16,
+                         std::conditional_t<sizeof(Key) == 4, UInt32, UInt64>>>;
+            constexpr Bits SIGN_BIT = Bits(Bits(1) << (sizeof(Key) * 8 - 1));
+
+            const Bits bits = std::bit_cast<Bits>(key);
+            if constexpr (std::is_floating_point_v<Key>)
+            {
+                const Bits mask = Bits(Bits(0) - Bits(bits >> (sizeof(Key) * 8 - 1))) | SIGN_BIT;
+                return Bits(bits ^ mask);
+            }
+            else if constexpr (std::is_signed_v<Key>)
+            {
+                return Bits(bits ^ SIGN_BIT);
+            } else {
+                return bits;
+            }
+        }
+    }
+
+    template <Manual Type, typename Compare = Less>
+    [[nodiscard]]
+    Bool is_sorted(const Type *data, const USize count, Compare compare = Compare{}) noexcept
+    {
+        for (USize i = 1; i < count; ++i)
+        {
+            if (compare(data[i], data[i - 1]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Branchless for scalar types, count has to be at most MAX_NETWORK_SIZE. Not stable.
+    template <Manual Type, typename Compare = Less>
+    Void network_sort(Type *data, const USize count, Compare compare = Compare{}) noexcept
+    {
+        assert(count <= MAX_NETWORK_SIZE && "Too many elements for sorting network!");
+        Detail::sort_network(data, count, compare);
+    }
+
+    // Pattern defeating quicksort. Sorted, reversed and many equal elements take linear time, adversarial
+    // input falls back to heap sort, so worst case is O(n log n). Not stable, does not allocate.
+    template <Manual Type, typename Compare = Less>
+    Void sort(Type *data, const USize count, Compare compare = Compare{}) noexcept
+    {
+        if (count < 2)
+        {
+            return;
+        }
+        Detail::pdqsort(data, data + count, compare, UInt32(std::bit_width(count)), true);
+    }
+
+    // Merge sort over runs sorted by insertion sort, equal elements keep their order. Allocates buffer of
+    // count elements.
+    template <Manual Type, typename Compare = Less>
+    Void stable_sort(Type *data, const USize count, Compare compare = Compare{},
+                     AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        if (count <= Detail::STABLE_RUN_SIZE)
+        {
+            Detail::insertion_sort<true>(data, data + count, compare);
+            return;
+        }
+
+        Type *buffer = Memory::allocate<Type>(allocator, count);
+        Detail::merge_sort(data, count, buffer, compare);
+        Memory::deallocate(allocator, buffer);
+    }
+
+    // Stable LSD radix sort by key(element), which returns integer or floating point value. One pass per
+    // key byte, passes where all elements share the byte are skipped. Floats are ordered by their bits,
+    // -0 goes before +0 and NaNs go to the end (or start when negative). Allocates buffer of count elements.
+    template <Manual Type, typename KeyFunction>
+    requires std::invocable<KeyFunction &, const Type &> &&
+             RadixKey<std::remove_cvref_t<std::invoke_result_t<KeyFunction &, const Type &>>>
+    Void radix_sort(Type *data, const USize count, KeyFunction &&key,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        assert(allocator && "Allocator is nullptr!");
+        using Key = std::remove_cvref_t<std::invoke_result_t<KeyFunction &, const Type &>>;
+        constexpr USize PASS_COUNT = sizeof(Key);
+
+        if (count <= Detail::RADIX_THRESHOLD)
+        {
+            auto compare = [&key](const Type &left, const Type &right)
+            {
+                return Detail::get_radix_bits(Key(key(left))) < Detail::get_radix_bits(Key(key(right)));
+            };
+            Detail::insertion_sort<true>(data, data + count, compare);
+            return;
+        }
+
+        USize histograms[PASS_COUNT][256] = {};
+        for (USize i = 0; i < count; ++i)
+        {
+            const auto bits = Detail::get_radix_bits(Key(key(data[i])));
+            for (USize pass = 0; pass < PASS_COUNT; ++pass)
+            {
+                ++histograms[pass][(bits >> (pass * 8)) & 0xFF];
+            }
+        }
+
+        Type *buffer = Memory::allocate<Type>(allocator, count);
+        Type *source = data;
+        Type *target = buffer;
+        for (USize pass = 0; pass < PASS_COUNT; ++pass)
+        {
+            USize *histogram = histograms[pass];
+            const USize firstDigit = (Detail::get_radix_bits(Key(key(source[0]))) >> (pass * 8)) & 0xFF;
+            if (histogram[firstDigit] == count)
+            {
+                continue;
+            }
+
+            USize offset = 0;
+            for (USize digit = 0; digit < 256; ++digit)
+            {
+                const USize digitCount = histogram[digit];
+                histogram[digit] = offset;
+                offset += digitCount;
+            }
+
+            for (USize i = 0; i < count; ++i)
+            {
+                const USize digit = (Detail::get_radix_bits(Key(key(source[i]))) >> (pass * 8)) & 0xFF;
+                Detail::relocate(target[histogram[digit]++], source[i]);
+            }
+            std::swap(source, target);
+        }
+
+        if (source != data)
+        {
+            for (USize i = 0; i < count; ++i)
+            {
+                Detail::relocate(data[i], source[i]);
+            }
+        }
+        Memory::deallocate(allocator, buffer);
+    }
+
+    template <RadixKey Type>
+    Void radix_sort(Type *data, const USize count,
+                    AllocatorInfo *allocator = AllocatorInfo::get_default_allocator()) noexcept
+    {
+        radix_sort(data, count, [](const Type value) { return value; }, allocator);
+    }
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <type_traits>
+#include <concepts>
 
 // Rename to be consistent with naming_convention
 using Bool	  = bool;
@@ -34,6 +35,12 @@ std::is_trivially_copyable_v<Type> &&
 std::is_nothrow_default_constructible_v<Type> ||
 std::is_same_v<Type, Void>;
 
+// Manual types can change address by copying bytes, types which keep pointers to themselves
+// or register their address somewhere opt out by declaring using IsPinned = Void;
+template <typename Type>
+concept Relocatable =
+Manual<Type> && !requires { typename Type::IsPinned; };
+
 template <typename Type>
 concept Copyable =
 requires(Type element, const Type &other) { element.copy(other); };
@@ -44,4 +51,8 @@ requires(Type element, Type &other) { element.move(other); };
 
 template <typename Type>
 concept Finalizable =
-requires(Type element) { element.finalize(); };
\ No newline at end of file
+requires(Type element) { element.finalize(); };
+
+template <typename Type>
+concept Ordered =
+requires(const Type &element, const Type &other) { { element < other } -> std::convertible_to<Bool>; };
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include "Utilities/simd.hpp"
+#include "Utilities/parallel_sort.hpp"
+#include "Structures/mpmc_queue.hpp"
+#include "Structures/list.hpp"
+#include "Memory/memory_utils.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+
+// Standalone benchmarks, build in Release. Every case reports best of several runs, so numbers show what
+// code can do on warm caches rather than average with scheduler noise.
+namespace
+{
+    constexpr USize RUN_COUNT = 7;
+
+    // Keeps results alive, so measured calls are not optimized away
+    volatile UInt64 sink = 0;
+
+    [[nodiscard]]
+    Float64 get_nanoseconds(const std::chrono::steady_clock::time_point start) noexcept
+    {
+        return std::chrono::duration<Float64, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Best time of one call in nanoseconds
+    template <typename Function>
+    Float64 measure(Function &&function, const USize repeatCount) noexcept
+    {
+        Float64 best = 1e300;
+        for (USize run = 0; run < RUN_COUNT; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (USize i = 0; i < repeatCount; ++i)
+            {
+                function();
+            }
+            best = std::min(best, get_nanoseconds(start) / Float64(repeatCount));
+        }
+        return best;
+    }
+
+    const Char *get_instruction_set_name(const Simd::EInstructionSet instructionSet) noexcept
+    {
+        switch (instructionSet)
+        {
+            case Simd::EInstructionSet::Avx2:
+                return "AVX2";
+            case Simd::EInstructionSet::Sse2:
+                return "SSE2";
+            default:
+                return "Scalar";
+        }
+    }
+
+    // Throughput of every kernel for every instruction set CPU supports, in GB/s of input. Searches look
+    // for value which is not in span and compared spans are equal, so whole span is scanned. Fill and
+    // replace_all write to separate buffer to keep compared spans equal.
+    template <Simd::Arithmetic Type>
+    Void benchmark_simd(const Char *typeName, const USize count) noexcept
+    {
+        AllocatorInfo *allocator = AllocatorInfo::get_default_allocator();
+        Type *data = Memory::allocate<Type>(allocator, count);
+        Type *copy = Memory::allocate<Type>(allocator, count);
+        Type *scratch = Memory::allocate<Type>(allocator, count);
+        std::mt19937_64 random(count);
+        for (USize i = 0; i < count; ++i)
+        {
+            data[i] = Type(random() % 100);
+            copy[i] = data[i];
+            scratch[i] = data[i];
+        }
+
+        const USize repeatCount = std::max(USize(1), (USize(64) << 20) / (count * sizeof(Type)));
+        const Float64 bytes = Float64(count * sizeof(Type));
+        const Type missing = Type(101);
+
+        for (const Simd::EInstructionSet instructionSet : { Simd::EInstructionSet::Scalar,
+                                                            Simd::EInstructionSet::Sse2,
+                                                            Simd::EInstructionSet::Avx2 })
+        {
+            const Simd::Kernels<Type> *kernels = Simd::get_kernels<Type>(instructionSet);
+            if (!kernels)
+            {
+                continue;
+            }
+
+            const Float64 find = measure([&]() { sink = sink + kernels->find(data, count, missing); }, repeatCount);
+            const Float64 countTime = measure([&]() { sink = sink + kernels->count(data, count, missing); }, repeatCount);
+            const Float64 min = measure([&]() { sink = sink + UInt64(kernels->min(data, count)); }, repeatCount);
+            const Float64 max = measure([&]() { sink = sink + UInt64(kernels->max(data, count)); }, repeatCount);
+            const Float64 sum = measure([&]() { sink = sink + UInt64(kernels->sum(data, count)); }, repeatCount);
+            const Float64 compare = measure([&]() { sink = sink + kernels->compare(data, copy, count); }, repeatCount);
+            const Float64 fill = measure([&]() { kernels->fill(scratch, count, data[0]); }, repeatCount);
+            const Float64 replace = measure([&]() { sink = sink + kernels->replace_all(scratch, count, missing, data[0]); },
+                                            repeatCount);
+
+            SPDLOG_INFO("{:>7} x {:>8} {:>6}: find {:6.1f} count {:6.1f} min {:6.1f} max {:6.1f} sum {:6.1f} "
+                        "compare {:6.1f} fill {:6.1f} replace_all {:6.1f} GB/s",
+                        typeName, count, get_instruction_set_name(instructionSet),
+                        bytes / find, bytes / countTime, bytes / min, bytes / max, bytes / sum,
+                        bytes / compare, bytes / fill, bytes / replace);
+        }
+
+        Memory::deallocate(allocator, data);
+        Memory::deallocate(allocator, copy);
+        Memory::deallocate(allocator, scratch);
+    }
+
+    Void benchmark_simd() noexcept
+    {
+        SPDLOG_INFO("SIMD kernels, dispatched instruction set is {}",
+                    get_instruction_set_name(Simd::get_instruction_set()));
+        for (const USize count : { USize(1) << 10, USize(1) << 20 })
+        {
+            benchmark_simd<UInt8>("UInt8", count);
+            benchmark_simd<Int16>("Int16", count);
+            benchmark_simd<Int32>("Int32", count);
+            benchmark_simd<Int64>("Int64", count);
+            benchmark_simd<Float32>("Float32", count);
+            benchmark_simd<Float64>("Float64", count);
+        }
+    }
+
+    // Sort time for 1, 2, 4... threads up to hardware thread count, speedup is relative to one thread, which
+    // is plain sort or stable_sort on calling thread. Every run sorts fresh copy of same random input.
+    Void benchmark_parallel_sort(const USize count, const Sort::EParallelSortMode mode,
+                                 const Char *modeName) noexcept
+    {
+        AllocatorInfo *allocator = AllocatorInfo::get_default_allocator();
+        UInt64 *input = Memory::allocate<UInt64>(allocator, count);
+        UInt64 *data = Memory::allocate<UInt64>(allocator, count);
+        std::mt19937_64 random(count);
+        for (USize i = 0; i < count; ++i)
+        {
+            input[i] = random();
+        }
+
+        const USize maxThreadCount = std::clamp(USize(std::thread::hardware_concurrency()), USize(1),
+                                                Sort::MAX_SORT_THREAD_COUNT);
+        Float64 singleThreadTime = 0.0;
+        for (USize threadCount = 1; threadCount <= maxThreadCount;
+             threadCount = threadCount == maxThreadCount ? threadCount + 1 : std::min(threadCount * 2, maxThreadCount))
+        {
+            Float64 best = 1e300;
+            for (USize run = 0; run < RUN_COUNT; ++run)
+            {
+                std::memcpy(data, input, count * sizeof(UInt64));
+                const auto start = std::chrono::steady_clock::now();
+                Sort::parallel_sort(data, count, Sort::Less{}, allocator, mode, threadCount);
+                best = std::min(best, get_nanoseconds(start));
+            }
+            if (threadCount == 1)
+            {
+                singleThreadTime = best;
+            }
+            sink = sink + data[count / 2];
+
+            SPDLOG_INFO("{:>13} x {:>8} on {:>2} threads: {:8.2f} ms, speedup {:5.2f}",
+                        modeName, count, threadCount, best / 1e6, singleThreadTime / best);
+        }
+
+        Memory::deallocate(allocator, input);
+        Memory::deallocate(allocator, data);
+    }
+
+    Void benchmark_parallel_sort() noexcept
+    {
+        SPDLOG_INFO("Parallel sort of UInt64, {} hardware threads", std::thread::hardware_concurrency());
+        for (const USize count : { USize(1) << 20, USize(1) << 23 })
+        {
+            benchmark_parallel_sort(count, Sort::EParallelSortMode::Fast, "Fast");
+            benchmark_parallel_sort(count, Sort::EParallelSortMode::Deterministic, "Deterministic");
+        }
+    }
+
+    constexpr USize MAX_QUEUE_THREAD_COUNT = 16;
+
+    // Best time to pass itemCount items through queue, producers push and consumers pop equal shares.
+    // Functions get thread index and number of items it handles.
+    template <typename Produce, typename Consume>
+    Float64 measure_producers_consumers(const USize threadsPerSide, const USize itemCount, Produce &&produce,
+                                        Consume &&consume) noexcept
+    {
+        const USize share = itemCount / threadsPerSide;
+        Float64 best = 1e300;
+        for (USize run = 0; run < RUN_COUNT; ++run)
+        {
+            std::thread threads[2 * MAX_QUEUE_THREAD_COUNT];
+            const auto start = std::chrono::steady_clock::now();
+            for (USize i = 0; i < threadsPerSide; ++i)
+            {
+                threads[2 * i] = std::thread([&produce, i, share]() { produce(i, share); });
+                threads[2 * i + 1] = std::thread([&consume, i, share]() { consume(i, share); });
+            }
+            for (USize i = 0; i < 2 * threadsPerSide; ++i)
+            {
+                threads[i].join();
+            }
+            best = std::min(best, get_nanoseconds(start));
+        }
+        return best;
+    }
+
+    // Same number of producer and consumer threads pass UInt64 items through MPMCQueue and through List
+    // guarded by std::mutex, results are in millions of items per second. Consumers of List spin with
+    // yield while it is empty, MPMCQueue consumers use blocking pop.
+    Void benchmark_queue(const USize threadsPerSide, const USize itemCount) noexcept
+    {
+        std::atomic<UInt64> checksum = 0;
+
+        MPMCQueue<UInt64> queue;
+        queue.initialize(1024);
+        const Float64 queueTime = measure_producers_consumers(threadsPerSide, itemCount,
+            [&](const USize thread, const USize share)
+            {
+                for (USize i = 0; i < share; ++i)
+                {
+                    queue.push(UInt64(thread * share + i));
+                }
+            },
+            [&](USize, const USize share)
+            {
+                UInt64 sum = 0;
+                for (USize i = 0; i < share; ++i)
+                {
+                    UInt64 item = 0;
+                    queue.pop(item);
+                    sum += item;
+                }
+                checksum += sum;
+            });
+        queue.finalize();
+
+        List<UInt64> list;
+        list.initialize();
+        std::mutex mutex;
+        const Float64 listTime = measure_producers_consumers(threadsPerSide, itemCount,
+            [&](const USize thread, const USize share)
+            {
+                for (USize i = 0; i < share; ++i)
+                {
+                    std::lock_guard lock(mutex);
+                    list.push_back(UInt64(thread * share + i));
+                }
+            },
+            [&](USize, const USize share)
+            {
+                UInt64 sum = 0;
+                for (USize i = 0; i < share;)
+                {
+                    {
+                        std::lock_guard lock(mutex);
+                        if (!list.is_empty())
+                        {
+                            sum += list.pop_front();
+                            ++i;
+                            continue;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+                checksum += sum;
+            });
+        list.finalize();
+
+        // Every run passes items 0 to passedCount - 1 once through both queues. Checked in every build,
+        // benchmark is meant to run in Release where assert is compiled out.
+        const USize passedCount = itemCount / threadsPerSide * threadsPerSide;
+        const UInt64 expected = UInt64(passedCount) * (passedCount - 1) / 2 * RUN_COUNT * 2;
+        if (checksum != expected)
+        {
+            SPDLOG_ERROR("Items were lost or duplicated, checksum {} instead of {}!", checksum.load(), expected);
+            std::abort();
+        }
+        sink = sink + checksum;
+
+        SPDLOG_INFO("{:>2} producers, {:>2} consumers: MPMCQueue {:7.2f} M/s, mutex List {:7.2f} M/s, ratio {:5.2f}",
+                    threadsPerSide, threadsPerSide, Float64(passedCount) / queueTime * 1e3,
+                    Float64(passedCount) / listTime * 1e3, listTime / queueTime);
+    }
+
+    Void benchmark_queue() noexcept
+    {
+        SPDLOG_INFO("MPMCQueue against List guarded by mutex, {} hardware threads", std::thread::hardware_concurrency());
+        for (USize threadsPerSide = 1; threadsPerSide <= MAX_QUEUE_THREAD_COUNT; threadsPerSide *= 2)
+        {
+            benchmark_queue(threadsPerSide, USize(1) << 20);
+        }
+    }
+}
+
+Int32 main()
+{
+    benchmark_simd();
+    benchmark_parallel_sort();
+    benchmark_queue();
+    return 0;
+}
\ No newline at end of file